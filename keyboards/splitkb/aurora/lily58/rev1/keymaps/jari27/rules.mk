@@ -1,3 +1,5 @@
+# the shared code is in users/jari27, its rules.mk adds the sources for the features turned on here
+
 # disable encoders
 ENCODER_ENABLE = no
 ENCODER_MAP_ENABLE = no
@@ -1,27 +1,10 @@
 #pragma once
 
-#undef PRODUCT
-#define PRODUCT "Jari's Aurora Lily58"
+// the settings shared with the other jari27 keymaps are in users/jari27/config.h
 
 // put your secrets (e.g. real name, phone number, etc. in here)
 #include "secrets.h"
 
-// normal rgb stuff
-#define RGB_MATRIX_MAXIMUM_BRIGHTNESS 128 // prevent crash
-#define ENABLE_RGB_MATRIX_SOLID_COLOR
-#define ENABLE_RGB_MATRIX_BREATHING
-#define RGB_MATRIX_LED_FLUSH_LIMIT 32 // increase keyboards responsiveness
-#define SPLIT_LAYER_STATE_ENABLE      // sync indicator leds
-
-// os detection
-#define SPLIT_DETECTED_OS_ENABLE
-
-// oled
-#define OLED_UPDATE_INTERVAL 100 // increase keyboard responsiveness
-#undef OLED_FONT_H
-#define OLED_FONT_H "keyboards/splitkb/aurora/lily58/rev1/keymaps/jari27_miryoku/glcdfont_with_win.c"
-#define SPLIT_WPM_ENABLE
-
 // combo
 #define COMBO_TERM 20
 #define COMBO_TERM_PER_COMBO    // ability to give difficult combos a larger window
@@ -31,3 +14,7 @@
 #define TAPPING_TERM 250
 #define TAPPING_TERM_PER_KEY
 #define QUICK_TAP_TERM 0 // prevent double tap to hold
+#define CHORDAL_HOLD               // home row mod and a key on the same hand: tap
+#define PERMISSIVE_HOLD            // home row mod around a key on the other hand: hold
+#define PERMISSIVE_HOLD_PER_KEY    // only for the home row mods, see get_permissive_hold
+#define FLOW_TAP_TERM 150          // home row mod pressed this soon after a letter: tap
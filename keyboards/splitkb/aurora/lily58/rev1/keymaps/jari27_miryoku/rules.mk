@@ -1,3 +1,8 @@
+# shares users/jari27 with the jari27 keymap instead of looking for users/jari27_miryoku
+USER_NAME := jari27
+
+# the shared code is in users/jari27, its rules.mk adds the sources for the features turned on here
+
 # disable encoders
 ENCODER_ENABLE = no
 ENCODER_MAP_ENABLE = no
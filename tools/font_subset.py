@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+"""Generate the OLED font with only the glyphs the jari27 screens use.
+
+    tools/font_subset.py            # rewrite users/jari27/glcdfont_subset.c and .h when the screens changed
+    tools/font_subset.py --check    # exit 1 if they are out of date
+
+QMK looks up a character as font[c - OLED_FONT_START], so the font can only lose glyphs from the front. The tiles from
+0x80 up (logo, mod and os icons) are written as raw codes, partly by the keyboard's code, and keep their places. The text
+characters the screens write are packed right below 0x80 and OLED_FONT_START moves up to the first of them. Everything
+below that, most of the ascii table and the symbols in front of it, is gone. Text is written with oled_write_text, which
+maps each character to its new place with the table in the header; characters that are not in the font map to a space,
+which is below OLED_FONT_START and drawn blank like before.
+
+The text is found in every function with render or oled_task in its name: string and character literals, string macros
+from the keymap configs, and all digits when a digit is computed from '0'.
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+USER = os.path.join(ROOT, 'users', 'jari27')
+FONT = os.path.join(USER, 'glcdfont_with_win.c')
+OUT_C = os.path.join(USER, 'glcdfont_subset.c')
+OUT_H = os.path.join(USER, 'glcdfont_subset.h')
+KEYMAPS = os.path.join(ROOT, 'keyboards', '**', 'keymaps', 'jari27*')
+
+WIDTH = 6
+TILES = 0x80  # first tile, the font keeps everything from here to the end as it is
+SPACE = ord(' ')
+
+FUNCTION = re.compile(r'^\w[\w \*]*?\b(\w*(?:render|oled_task)\w*)\s*\([^;{]*\)\s*\{', re.M)
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'')
+STRING_DEFINE = re.compile(r'^\s*#\s*define\s+(\w+)\s+"((?:[^"\\\n]|\\.)*)"', re.M)
+ESCAPES = {'n': '\n', 't': '\t', '0': '\0', '\\': '\\', '\'': '\'', '"': '"'}
+
+
+def strip_comments(source):
+    """Comments out, literals left alone, so a quote in a comment does not start a string."""
+    return re.sub(r'//[^\n]*|/\*.*?\*/|"(?:[^"\\\n]|\\.)*"|\'(?:[^\'\\\n]|\\.)*\'',
+                  lambda m: m.group(0) if m.group(0)[0] in '"\'' else ' ', source, flags=re.S)
+
+
+def unescape(text):
+    return re.sub(r'\\(x[0-9a-fA-F]{1,2}|.)',
+                  lambda m: chr(int(m.group(1)[1:], 16)) if m.group(1)[0] == 'x' else ESCAPES.get(m.group(1), m.group(1)),
+                  text)
+
+
+def function_bodies(source):
+    """(name, body) of every render function, the body up to its matching brace."""
+    for match in FUNCTION.finditer(source):
+        depth, end = 0, match.end() - 1
+        for end in range(match.end() - 1, len(source)):
+            if source[end] == '{':
+                depth += 1
+            elif source[end] == '}':
+                depth -= 1
+                if depth == 0:
+                    break
+        yield match.group(1), source[match.end():end]
+
+
+def used_text(sources, configs):
+    """Every text character the screens can write, and where each one came from."""
+    macros = {}
+    for path in configs:
+        with open(path) as f:
+            for name, value in STRING_DEFINE.findall(strip_comments(f.read())):
+                macros.setdefault(name, []).append(unescape(value))
+    chars = {}
+    for path in sources:
+        with open(path) as f:
+            source = strip_comments(f.read())
+        for name, body in function_bodies(source):
+            found = ''.join(unescape(string or char) for string, char in LITERAL.findall(body))
+            for word in set(re.findall(r'\b[A-Z_][A-Z0-9_]*\b', body)) & set(macros):
+                found += ''.join(macros[word])
+            if re.search(r'\'0\'\s*\+', body):
+                found += '0123456789'
+            for c in found:
+                chars.setdefault(c, set()).add('%s:%s' % (os.path.relpath(path, ROOT), name))
+    return {c: where for c, where in chars.items() if SPACE < ord(c) < TILES}
+
+
+def read_font(path):
+    with open(path) as f:
+        source = f.read()
+    body = source[source.index('{', source.index('font[]')) + 1:source.index('};')]
+    data = [int(value, 16) for value in re.findall(r'0x([0-9a-fA-F]{2})', strip_comments(body))]
+    if len(data) % WIDTH or len(data) // WIDTH <= TILES:
+        sys.exit('%s: expected %d byte glyphs up to at least 0x%02x' % (path, WIDTH, TILES))
+    return [data[i:i + WIDTH] for i in range(0, len(data), WIDTH)]
+
+
+def glyph_lines(glyph, comment):
+    return '  %s, // %s\n' % (', '.join('0x%02X' % b for b in glyph), comment)
+
+
+def describe(c):
+    return "'%s'" % c if c not in '\\\'' else repr(c)
+
+
+def generate(chars, font):
+    text = sorted(chars)
+    start = TILES - len(text)
+    if start <= SPACE:
+        sys.exit('%d text characters do not fit between the space and the tiles' % len(text))
+    end = len(font) - 1
+    place = {c: start + i for i, c in enumerate(text)}
+
+    out_c = ('#include "progmem.h"\n\n'
+             '// generated by tools/font_subset.py from glcdfont_with_win.c, do not edit. the text characters the screens\n'
+             '// use, then the tiles from 0x%02X as they are in the full font\n\n'
+             'const unsigned char font[] PROGMEM = {\n' % TILES)
+    for c in text:
+        out_c += glyph_lines(font[ord(c)], '0x%02X %s' % (place[c], describe(c)))
+    for code in range(TILES, end + 1):
+        out_c += glyph_lines(font[code], '0x%02X' % code)
+    out_c += '};\n'
+
+    table = ''.join('\\x%02x' % (place.get(chr(code), code if code == ord('\n') else SPACE)) for code in range(TILES))
+    out_h = ('#pragma once\n\n'
+             '// generated by tools/font_subset.py, do not edit. glcdfont_subset.c starts at OLED_FONT_START, the text\n'
+             '// characters below 0x%02X are looked up in FONT_SUBSET_TEXT_MAP, see oled_write_text\n\n'
+             '#define OLED_FONT_START %d\n'
+             '#define OLED_FONT_END %d\n\n'
+             '// clang-format off\n'
+             '#define FONT_SUBSET_TEXT_MAP \\\n' % (TILES, start, end))
+    for row in range(0, len(table), 64):
+        out_h += '    "%s"%s\n' % (table[row:row + 64], ' \\' if row + 64 < len(table) else '')
+    out_h += '// clang-format on\n'
+    return out_c, out_h, start, end
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--check', action='store_true', help='only report if the generated files are out of date')
+    parser.add_argument('--list', action='store_true', help='print the characters found and where they are used')
+    args = parser.parse_args()
+
+    keymaps = glob.glob(KEYMAPS, recursive=True)
+    sources = sorted(glob.glob(os.path.join(USER, '*.c')) + [os.path.join(k, 'keymap.c') for k in keymaps])
+    sources = [path for path in sources if not os.path.basename(path).startswith('glcdfont')]
+    configs = sorted([os.path.join(USER, 'config.h')] + [os.path.join(k, 'config.h') for k in keymaps])
+    chars = used_text(sources, [path for path in configs if os.path.exists(path)])
+    font = read_font(FONT)
+    out_c, out_h, start, end = generate(chars, font)
+
+    if args.list:
+        for c in sorted(chars):
+            print('%s  %s' % (describe(c), ', '.join(sorted(chars[c]))))
+
+    stale = []
+    for path, content in ((OUT_C, out_c), (OUT_H, out_h)):
+        current = open(path).read() if os.path.exists(path) else None
+        if current != content:
+            stale.append(path)
+            if not args.check:
+                with open(path, 'w') as f:
+                    f.write(content)
+    if args.check:
+        for path in stale:
+            print('%s is out of date, run tools/font_subset.py' % os.path.relpath(path, ROOT), file=sys.stderr)
+        sys.exit(1 if stale else 0)
+    glyphs = end + 1 - start
+    print('%d of %d glyphs, %d bytes instead of %d' % (glyphs, len(font), glyphs * WIDTH, len(font) * WIDTH))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,7 @@
+// strings for sendbench, packed into build/<keymap>/bench_strings_nkro.h by tools/nkro_pack.py
+#pragma once
+
+#define BENCH_OTP "cccccbhkdtlrfhvjkuenkvhvbuutikllgrgnbnckvdhb" // yubikey otp, modhex
+#define BENCH_SENTENCE "The quick brown fox jumps over the lazy dog."
+#define BENCH_PASSWORD "Tr0ub4dor&3_Correct-Horse!"
+#define BENCH_COMMAND "git log --oneline --graph -20 | grep -i fix\n"
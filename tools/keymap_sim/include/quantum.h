@@ -0,0 +1,815 @@
+// Host-side stand-in for the parts of the QMK core that the keymaps touch.
+// Values follow upstream qmk_firmware where it matters (keycode ranges, mod bits), everything that talks to
+// hardware is a no-op or a counter in sim_core.c.
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+// keyboard level defines normally coming from keyboard.json
+#define MATRIX_ROWS 10
+#define MATRIX_COLS 6
+#define RGB_MATRIX_LED_COUNT 58
+#define SPLIT_KEYBOARD
+
+#define COMBO_ENABLE
+#define CAPS_WORD_ENABLE
+#define OLED_ENABLE
+#define RGB_MATRIX_ENABLE
+#define WPM_ENABLE
+#define OS_DETECTION_ENABLE
+#define NKRO_ENABLE
+#define CONSOLE_ENABLE
+
+#include "config.h"
+#ifdef SIM_USER_CONFIG
+#    include SIM_USER_CONFIG
+#endif
+#ifdef SIM_CONFIG_OVERRIDE
+#    include SIM_CONFIG_OVERRIDE
+#endif
+
+#ifndef TAPPING_TERM
+#    define TAPPING_TERM 200
+#endif
+#ifndef COMBO_TERM
+#    define COMBO_TERM 50
+#endif
+#ifndef ONESHOT_TIMEOUT
+#    define ONESHOT_TIMEOUT 0
+#endif
+#ifndef OLED_UPDATE_INTERVAL
+#    define OLED_UPDATE_INTERVAL 50
+#endif
+#ifndef RGB_MATRIX_LED_FLUSH_LIMIT
+#    define RGB_MATRIX_LED_FLUSH_LIMIT 16
+#endif
+#ifndef RGB_MATRIX_MAXIMUM_BRIGHTNESS
+#    define RGB_MATRIX_MAXIMUM_BRIGHTNESS 255
+#endif
+#ifndef CAPS_WORD_IDLE_TIMEOUT
+#    define CAPS_WORD_IDLE_TIMEOUT 5000
+#endif
+#ifndef RGB_MATRIX_VAL_STEP
+#    define RGB_MATRIX_VAL_STEP 16
+#endif
+#ifndef EECONFIG_USER_DATA_SIZE
+#    define EECONFIG_USER_DATA_SIZE 0
+#endif
+
+#define PROGMEM
+#define PSTR(s) s
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+/* keycodes */
+
+enum sim_basic_keycodes {
+    KC_NO                  = 0x00,
+    KC_TRANSPARENT         = 0x01,
+    KC_A                   = 0x04,
+    KC_B,
+    KC_C,
+    KC_D,
+    KC_E,
+    KC_F,
+    KC_G,
+    KC_H,
+    KC_I,
+    KC_J,
+    KC_K,
+    KC_L,
+    KC_M,
+    KC_N,
+    KC_O,
+    KC_P,
+    KC_Q,
+    KC_R,
+    KC_S,
+    KC_T,
+    KC_U,
+    KC_V,
+    KC_W,
+    KC_X,
+    KC_Y,
+    KC_Z,
+    KC_1,
+    KC_2,
+    KC_3,
+    KC_4,
+    KC_5,
+    KC_6,
+    KC_7,
+    KC_8,
+    KC_9,
+    KC_0,
+    KC_ENTER,
+    KC_ESCAPE,
+    KC_BACKSPACE,
+    KC_TAB,
+    KC_SPACE,
+    KC_MINUS,
+    KC_EQUAL,
+    KC_LEFT_BRACKET,
+    KC_RIGHT_BRACKET,
+    KC_BACKSLASH,
+    KC_NONUS_HASH,
+    KC_SEMICOLON,
+    KC_QUOTE,
+    KC_GRAVE,
+    KC_COMMA,
+    KC_DOT,
+    KC_SLASH,
+    KC_CAPS_LOCK,
+    KC_F1,
+    KC_F2,
+    KC_F3,
+    KC_F4,
+    KC_F5,
+    KC_F6,
+    KC_F7,
+    KC_F8,
+    KC_F9,
+    KC_F10,
+    KC_F11,
+    KC_F12,
+    KC_PRINT_SCREEN,
+    KC_SCROLL_LOCK,
+    KC_PAUSE,
+    KC_INSERT,
+    KC_HOME,
+    KC_PAGE_UP,
+    KC_DELETE,
+    KC_END,
+    KC_PAGE_DOWN,
+    KC_RIGHT,
+    KC_LEFT,
+    KC_DOWN,
+    KC_UP,
+    KC_APPLICATION         = 0x65,
+    KC_AUDIO_MUTE          = 0xA8,
+    KC_AUDIO_VOL_UP,
+    KC_AUDIO_VOL_DOWN,
+    KC_MEDIA_NEXT_TRACK,
+    KC_MEDIA_PREV_TRACK,
+    KC_MEDIA_STOP,
+    KC_MEDIA_PLAY_PAUSE,
+    KC_MS_UP               = 0xCD,
+    KC_MS_DOWN,
+    KC_MS_LEFT,
+    KC_MS_RIGHT,
+    KC_MS_BTN1,
+    KC_MS_BTN2,
+    KC_MS_BTN3,
+    KC_MS_BTN4,
+    KC_MS_BTN5,
+    KC_MS_BTN6,
+    KC_MS_BTN7,
+    KC_MS_BTN8,
+    KC_MS_WH_UP,
+    KC_MS_WH_DOWN,
+    KC_MS_WH_LEFT,
+    KC_MS_WH_RIGHT,
+    KC_LEFT_CTRL           = 0xE0,
+    KC_LEFT_SHIFT,
+    KC_LEFT_ALT,
+    KC_LEFT_GUI,
+    KC_RIGHT_CTRL,
+    KC_RIGHT_SHIFT,
+    KC_RIGHT_ALT,
+    KC_RIGHT_GUI,
+};
+
+#define XXXXXXX KC_NO
+#define _______ KC_TRANSPARENT
+#define KC_TRNS KC_TRANSPARENT
+#define KC_ENT KC_ENTER
+#define KC_ESC KC_ESCAPE
+#define KC_BSPC KC_BACKSPACE
+#define KC_SPC KC_SPACE
+#define KC_MINS KC_MINUS
+#define KC_EQL KC_EQUAL
+#define KC_LBRC KC_LEFT_BRACKET
+#define KC_RBRC KC_RIGHT_BRACKET
+#define KC_BSLS KC_BACKSLASH
+#define KC_SCLN KC_SEMICOLON
+#define KC_QUOT KC_QUOTE
+#define KC_GRV KC_GRAVE
+#define KC_COMM KC_COMMA
+#define KC_SLSH KC_SLASH
+#define KC_CAPS KC_CAPS_LOCK
+#define KC_DEL KC_DELETE
+#define KC_PGUP KC_PAGE_UP
+#define KC_PGDN KC_PAGE_DOWN
+#define KC_RGHT KC_RIGHT
+#define KC_APP KC_APPLICATION
+#define KC_MUTE KC_AUDIO_MUTE
+#define KC_VOLU KC_AUDIO_VOL_UP
+#define KC_VOLD KC_AUDIO_VOL_DOWN
+#define KC_MNXT KC_MEDIA_NEXT_TRACK
+#define KC_MPRV KC_MEDIA_PREV_TRACK
+#define KC_MSTP KC_MEDIA_STOP
+#define KC_MPLY KC_MEDIA_PLAY_PAUSE
+#define KC_MS_U KC_MS_UP
+#define KC_MS_D KC_MS_DOWN
+#define KC_MS_L KC_MS_LEFT
+#define KC_MS_R KC_MS_RIGHT
+#define KC_BTN1 KC_MS_BTN1
+#define KC_BTN2 KC_MS_BTN2
+#define KC_BTN3 KC_MS_BTN3
+#define KC_WH_U KC_MS_WH_UP
+#define KC_WH_D KC_MS_WH_DOWN
+#define KC_WH_L KC_MS_WH_LEFT
+#define KC_WH_R KC_MS_WH_RIGHT
+#define KC_LCTL KC_LEFT_CTRL
+#define KC_LSFT KC_LEFT_SHIFT
+#define KC_LALT KC_LEFT_ALT
+#define KC_LGUI KC_LEFT_GUI
+#define KC_LCMD KC_LEFT_GUI
+#define KC_RCTL KC_RIGHT_CTRL
+#define KC_RSFT KC_RIGHT_SHIFT
+#define KC_RALT KC_RIGHT_ALT
+#define KC_RGUI KC_RIGHT_GUI
+
+#define IS_BASIC_KEYCODE(kc) ((kc) >= KC_A && (kc) <= KC_APPLICATION)
+#define IS_MODIFIER_KEYCODE(kc) ((kc) >= KC_LEFT_CTRL && (kc) <= KC_RIGHT_GUI)
+
+/* quantum keycode ranges */
+
+#define QK_BASIC 0x0000
+#define QK_MODS 0x0100
+#define QK_LCTL 0x0100
+#define QK_LSFT 0x0200
+#define QK_LALT 0x0400
+#define QK_LGUI 0x0800
+#define QK_RMODS_MIN 0x1000
+#define QK_RCTL 0x1100
+#define QK_RSFT 0x1200
+#define QK_RALT 0x1400
+#define QK_RGUI 0x1800
+#define QK_MODS_MAX 0x1FFF
+#define QK_MOD_TAP 0x2000
+#define QK_MOD_TAP_MAX 0x3FFF
+#define QK_LAYER_TAP 0x4000
+#define QK_LAYER_TAP_MAX 0x4FFF
+#define QK_MOMENTARY 0x5220
+#define QK_MOMENTARY_MAX 0x523F
+#define QK_ONE_SHOT_MOD 0x52A0
+#define QK_ONE_SHOT_MOD_MAX 0x52BF
+#define QK_PERSISTENT_DEF_LAYER 0x52E0
+#define QK_PERSISTENT_DEF_LAYER_MAX 0x52FF
+#define QK_LIGHTING 0x7800
+#define QK_LIGHTING_MAX 0x78FF
+#define QK_QUANTUM 0x7C00
+#define QK_QUANTUM_MAX 0x7DFF
+#define QK_KB 0x7E00
+#define QK_USER 0x7E40
+#define SAFE_RANGE QK_USER
+
+#define QK_MODS_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MODS_GET_BASIC_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_MOD_TAP_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MOD_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_LAYER_TAP_GET_LAYER(kc) (((kc) >> 8) & 0xF)
+#define QK_LAYER_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_MOMENTARY_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_ONE_SHOT_MOD_GET_MODS(kc) ((kc) & 0x1F)
+#define QK_PERSISTENT_DEF_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+
+#define IS_QK_MODS(kc) ((kc) >= QK_MODS && (kc) <= QK_MODS_MAX)
+#define IS_QK_MOD_TAP(kc) ((kc) >= QK_MOD_TAP && (kc) <= QK_MOD_TAP_MAX)
+#define IS_QK_LAYER_TAP(kc) ((kc) >= QK_LAYER_TAP && (kc) <= QK_LAYER_TAP_MAX)
+#define IS_QK_MOMENTARY(kc) ((kc) >= QK_MOMENTARY && (kc) <= QK_MOMENTARY_MAX)
+#define IS_QK_ONE_SHOT_MOD(kc) ((kc) >= QK_ONE_SHOT_MOD && (kc) <= QK_ONE_SHOT_MOD_MAX)
+#define IS_QK_PERSISTENT_DEF_LAYER(kc) ((kc) >= QK_PERSISTENT_DEF_LAYER && (kc) <= QK_PERSISTENT_DEF_LAYER_MAX)
+
+/* 5 bit mod encoding used inside keycodes */
+#define MOD_LCTL 0x01
+#define MOD_LSFT 0x02
+#define MOD_LALT 0x04
+#define MOD_LGUI 0x08
+#define MOD_RCTL 0x11
+#define MOD_RSFT 0x12
+#define MOD_RALT 0x14
+#define MOD_RGUI 0x18
+#define MOD_MEH 0x07
+#define MOD_HYPR 0x0F
+
+/* 8 bit mod bits used in reports and get_mods() */
+#define MOD_BIT(kc) (1 << ((kc) & 0x07))
+#define MOD_BIT_LCTRL MOD_BIT(KC_LEFT_CTRL)
+#define MOD_BIT_LSHIFT MOD_BIT(KC_LEFT_SHIFT)
+#define MOD_BIT_LALT MOD_BIT(KC_LEFT_ALT)
+#define MOD_BIT_LGUI MOD_BIT(KC_LEFT_GUI)
+#define MOD_BIT_RCTRL MOD_BIT(KC_RIGHT_CTRL)
+#define MOD_BIT_RSHIFT MOD_BIT(KC_RIGHT_SHIFT)
+#define MOD_BIT_RALT MOD_BIT(KC_RIGHT_ALT)
+#define MOD_BIT_RGUI MOD_BIT(KC_RIGHT_GUI)
+#define MOD_MASK_CTRL (MOD_BIT_LCTRL | MOD_BIT_RCTRL)
+#define MOD_MASK_SHIFT (MOD_BIT_LSHIFT | MOD_BIT_RSHIFT)
+#define MOD_MASK_ALT (MOD_BIT_LALT | MOD_BIT_RALT)
+#define MOD_MASK_GUI (MOD_BIT_LGUI | MOD_BIT_RGUI)
+#define MOD_MASK_CS (MOD_MASK_CTRL | MOD_MASK_SHIFT)
+#define MOD_MASK_CG (MOD_MASK_CTRL | MOD_MASK_GUI)
+
+#define LCTL(kc) (QK_LCTL | (kc))
+#define LSFT(kc) (QK_LSFT | (kc))
+#define LALT(kc) (QK_LALT | (kc))
+#define LGUI(kc) (QK_LGUI | (kc))
+#define LCMD(kc) LGUI(kc)
+#define RCTL(kc) (QK_RCTL | (kc))
+#define RSFT(kc) (QK_RSFT | (kc))
+#define RCS(kc) (QK_RCTL | QK_RSFT | (kc))
+#define S(kc) LSFT(kc)
+
+#define MT(mod, kc) (QK_MOD_TAP | (((mod) & 0x1F) << 8) | ((kc) & 0xFF))
+#define LCTL_T(kc) MT(MOD_LCTL, kc)
+#define LSFT_T(kc) MT(MOD_LSFT, kc)
+#define LALT_T(kc) MT(MOD_LALT, kc)
+#define LGUI_T(kc) MT(MOD_LGUI, kc)
+#define RCTL_T(kc) MT(MOD_RCTL, kc)
+#define RSFT_T(kc) MT(MOD_RSFT, kc)
+#define RALT_T(kc) MT(MOD_RALT, kc)
+#define RGUI_T(kc) MT(MOD_RGUI, kc)
+#define LT(layer, kc) (QK_LAYER_TAP | (((layer) & 0xF) << 8) | ((kc) & 0xFF))
+#define MO(layer) (QK_MOMENTARY | ((layer) & 0x1F))
+#define OSM(mod) (QK_ONE_SHOT_MOD | ((mod) & 0x1F))
+#define PDF(layer) (QK_PERSISTENT_DEF_LAYER | ((layer) & 0x1F))
+
+#define KC_TILD S(KC_GRV)
+#define KC_EXLM S(KC_1)
+#define KC_AT S(KC_2)
+#define KC_HASH S(KC_3)
+#define KC_DLR S(KC_4)
+#define KC_PERC S(KC_5)
+#define KC_CIRC S(KC_6)
+#define KC_AMPR S(KC_7)
+#define KC_ASTR S(KC_8)
+#define KC_LPRN S(KC_9)
+#define KC_RPRN S(KC_0)
+#define KC_UNDS S(KC_MINS)
+#define KC_PLUS S(KC_EQL)
+#define KC_LCBR S(KC_LBRC)
+#define KC_RCBR S(KC_RBRC)
+#define KC_PIPE S(KC_BSLS)
+#define KC_COLN S(KC_SCLN)
+#define KC_DQUO S(KC_QUOT)
+#define KC_LT S(KC_COMM)
+#define KC_GT S(KC_DOT)
+#define KC_QUES S(KC_SLSH)
+
+enum sim_quantum_keycodes {
+    QK_BOOT                = QK_QUANTUM,
+    QK_REBOOT,
+    QK_DEBUG_TOGGLE,
+    QK_CLEAR_EEPROM,
+    QK_CAPS_WORD_TOGGLE    = QK_QUANTUM + 0x73,
+    QK_UNDERGLOW_TOGGLE    = QK_LIGHTING + 0x20,
+    QK_UNDERGLOW_MODE_NEXT,
+    QK_UNDERGLOW_MODE_PREVIOUS,
+    QK_UNDERGLOW_HUE_UP,
+    QK_UNDERGLOW_HUE_DOWN,
+    QK_UNDERGLOW_SATURATION_UP,
+    QK_UNDERGLOW_SATURATION_DOWN,
+    QK_UNDERGLOW_VALUE_UP,
+    QK_UNDERGLOW_VALUE_DOWN,
+    QK_UNDERGLOW_SPEED_UP,
+    QK_UNDERGLOW_SPEED_DOWN,
+    QK_RGB_MATRIX_ON       = QK_LIGHTING + 0x40,
+    QK_RGB_MATRIX_OFF,
+    QK_RGB_MATRIX_TOGGLE,
+    QK_RGB_MATRIX_MODE_NEXT,
+    QK_RGB_MATRIX_MODE_PREVIOUS,
+    QK_RGB_MATRIX_HUE_UP,
+    QK_RGB_MATRIX_HUE_DOWN,
+    QK_RGB_MATRIX_SATURATION_UP,
+    QK_RGB_MATRIX_SATURATION_DOWN,
+    QK_RGB_MATRIX_VALUE_UP,
+    QK_RGB_MATRIX_VALUE_DOWN,
+    QK_RGB_MATRIX_SPEED_UP,
+    QK_RGB_MATRIX_SPEED_DOWN,
+};
+
+#define EE_CLR QK_CLEAR_EEPROM
+#define DB_TOGG QK_DEBUG_TOGGLE
+#define CW_TOGG QK_CAPS_WORD_TOGGLE
+#define RM_TOGG QK_RGB_MATRIX_TOGGLE
+#define RM_NEXT QK_RGB_MATRIX_MODE_NEXT
+#define RM_HUEU QK_RGB_MATRIX_HUE_UP
+#define RM_HUED QK_RGB_MATRIX_HUE_DOWN
+#define RM_SATU QK_RGB_MATRIX_SATURATION_UP
+#define RM_SATD QK_RGB_MATRIX_SATURATION_DOWN
+#define RM_VALU QK_RGB_MATRIX_VALUE_UP
+#define RM_VALD QK_RGB_MATRIX_VALUE_DOWN
+#define RGB_TOG QK_UNDERGLOW_TOGGLE
+#define RGB_MOD QK_UNDERGLOW_MODE_NEXT
+#define RGB_HUI QK_UNDERGLOW_HUE_UP
+#define RGB_HUD QK_UNDERGLOW_HUE_DOWN
+#define RGB_SAI QK_UNDERGLOW_SATURATION_UP
+#define RGB_SAD QK_UNDERGLOW_SATURATION_DOWN
+#define RGB_VAI QK_UNDERGLOW_VALUE_UP
+#define RGB_VAD QK_UNDERGLOW_VALUE_DOWN
+#define RGB_SPI QK_UNDERGLOW_SPEED_UP
+#define RGB_SPD QK_UNDERGLOW_SPEED_DOWN
+
+/* key records */
+
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+typedef struct {
+    keypos_t key;
+    uint16_t time;
+    uint8_t  type;
+    bool     pressed;
+} keyevent_t;
+
+typedef struct {
+    bool    interrupted : 1;
+    bool    reserved2 : 1;
+    bool    reserved1 : 1;
+    bool    reserved0 : 1;
+    uint8_t count : 4;
+} tap_t;
+
+typedef struct {
+    keyevent_t event;
+    tap_t      tap;
+    uint16_t   keycode;
+} keyrecord_t;
+
+/* layers */
+
+typedef uint32_t layer_state_t;
+
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+uint8_t       get_highest_layer(layer_state_t state);
+void          layer_on(uint8_t layer);
+void          layer_off(uint8_t layer);
+bool          layer_state_is(uint8_t layer);
+void          default_layer_set(layer_state_t state);
+void          set_single_persistent_default_layer(uint8_t layer);
+uint16_t      keymap_key_to_keycode(uint8_t layer, keypos_t key);
+uint8_t       keymap_layer_count(void);
+layer_state_t layer_state_set_user(layer_state_t state);
+layer_state_t default_layer_state_set_user(layer_state_t state);
+
+/* mods and reports */
+
+uint8_t get_mods(void);
+void    add_mods(uint8_t mods);
+void    del_mods(uint8_t mods);
+void    set_mods(uint8_t mods);
+void    clear_mods(void);
+uint8_t get_weak_mods(void);
+void    add_weak_mods(uint8_t mods);
+void    del_weak_mods(uint8_t mods);
+void    set_weak_mods(uint8_t mods);
+void    clear_weak_mods(void);
+void    register_weak_mods(uint8_t mods);
+void    unregister_weak_mods(uint8_t mods);
+void    register_mods(uint8_t mods);
+void    unregister_mods(uint8_t mods);
+uint8_t get_oneshot_mods(void);
+void    add_oneshot_mods(uint8_t mods);
+void    del_oneshot_mods(uint8_t mods);
+void    set_oneshot_mods(uint8_t mods);
+void    clear_oneshot_mods(void);
+#define KEYBOARD_REPORT_KEYS 6 // keys in a report when the host does not use nkro
+void    add_key(uint8_t key);
+void    del_key(uint8_t key);
+void    clear_keys(void);
+void    send_keyboard_report(void);
+void    clear_keyboard(void);
+
+void register_code(uint8_t code);
+void unregister_code(uint8_t code);
+void tap_code(uint8_t code);
+void register_code16(uint16_t code);
+void unregister_code16(uint16_t code);
+void tap_code16(uint16_t code);
+void send_string(const char *str);
+bool host_can_send_nkro(void);
+#define SEND_STRING(string) send_string(PSTR(string))
+
+/* host driver, send_keyboard_report hands every new report to send_nkro or send_keyboard */
+
+#define NKRO_REPORT_BITS 30
+
+typedef struct {
+    uint8_t mods;
+    uint8_t reserved;
+    uint8_t keys[KEYBOARD_REPORT_KEYS];
+} report_keyboard_t;
+
+typedef struct {
+    uint8_t report_id;
+    uint8_t mods;
+    uint8_t bits[NKRO_REPORT_BITS];
+} report_nkro_t;
+
+typedef struct report_mouse_t report_mouse_t;
+typedef struct report_extra_t report_extra_t;
+
+typedef struct {
+    uint8_t (*keyboard_leds)(void);
+    void (*send_keyboard)(report_keyboard_t *report);
+    void (*send_nkro)(report_nkro_t *report);
+    void (*send_mouse)(report_mouse_t *report);
+    void (*send_extra)(report_extra_t *report);
+} host_driver_t;
+
+host_driver_t *host_get_driver(void);
+void           host_set_driver(host_driver_t *driver);
+
+/* matrix, the delays around reading a row are weak in upstream's matrix_common.c */
+
+#define COL2ROW 0
+#define ROW2COL 1
+#define DIODE_DIRECTION COL2ROW
+#define waitInputPinDelay()
+
+void matrix_io_delay(void);
+void matrix_output_select_delay(void);
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed);
+
+/* quantum hooks */
+
+bool     process_record_user(uint16_t keycode, keyrecord_t *record);
+void     post_process_record_user(uint16_t keycode, keyrecord_t *record);
+bool     pre_process_record_user(uint16_t keycode, keyrecord_t *record);
+void     keyboard_post_init_user(void);
+void     matrix_scan_user(void);
+void     matrix_slave_scan_user(void);
+void     housekeeping_task_user(void);
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record);
+
+/* tap-hold options, each only does something when the keymap turns it on in config.h */
+
+bool     get_permissive_hold(uint16_t keycode, keyrecord_t *record);
+char     chordal_hold_handedness(keypos_t key);
+bool     get_chordal_hold_default(keyrecord_t *tap_hold_record, keyrecord_t *other_record);
+bool     get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t *tap_hold_record, uint16_t other_keycode,
+                          keyrecord_t *other_record);
+bool     is_flow_tap_key(uint16_t keycode);
+uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_keycode);
+
+/* combos */
+
+#define COMBO_END 0
+
+typedef struct {
+    const uint16_t *keys;
+    uint16_t        keycode;
+    bool            disabled;
+    bool            active;
+} combo_t;
+
+#define COMBO(ck, ca) {.keys = &(ck)[0], .keycode = (ca)}
+
+uint16_t get_combo_term(uint16_t index, combo_t *combo);
+uint16_t combo_count(void);
+combo_t *combo_get(uint16_t combo_idx);
+void     combo_enable(void);
+void     combo_disable(void);
+bool     is_combo_enabled(void);
+
+/* caps word */
+
+void caps_word_on(void);
+void caps_word_off(void);
+void caps_word_toggle(void);
+bool is_caps_word_on(void);
+bool caps_word_press_user(uint16_t keycode);
+void caps_word_set_user(bool active);
+
+/* timer */
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+#define TIMER_DIFF_16(a, b) (uint16_t)((a) - (b))
+#define TIMER_DIFF_32(a, b) (uint32_t)((a) - (b))
+
+/* deferred executor, run once per loop like upstream's */
+
+#define MAX_DEFERRED_EXECUTORS 8
+#define INVALID_DEFERRED_TOKEN 0
+
+typedef uint8_t deferred_token;
+typedef uint32_t (*deferred_exec_callback)(uint32_t trigger_time, void *cb_arg);
+
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
+bool           cancel_deferred_exec(deferred_token token);
+
+/* debug */
+
+extern bool debug_enable;
+extern bool debug_keyboard;
+extern bool debug_matrix;
+#define dprintf(...)                           \
+    do {                                       \
+        if (debug_enable) printf(__VA_ARGS__); \
+    } while (0)
+#define uprintf(...) printf(__VA_ARGS__)
+
+// raw console output, goes to stderr so it does not mix with the replay output
+int8_t sendchar(uint8_t c);
+
+/* eeprom, the user datablock only, kept in memory for the length of a run */
+
+void eeconfig_read_user_datablock(void *data, uint8_t offset, uint8_t length);
+void eeconfig_update_user_datablock(const void *data, uint8_t offset, uint8_t length);
+bool shutdown_user(bool jump_to_bootloader);
+
+/* activity */
+
+uint32_t last_input_activity_elapsed(void);
+
+/* split */
+
+bool is_keyboard_master(void);
+bool is_keyboard_left(void);
+
+/* os detection */
+
+typedef enum {
+    OS_UNSURE,
+    OS_LINUX,
+    OS_WINDOWS,
+    OS_MACOS,
+    OS_IOS,
+} os_variant_t;
+
+os_variant_t detected_host_os(void);
+bool         process_detected_host_os_user(os_variant_t detected_os);
+
+/* split transactions, rpcs are counted instead of sent */
+
+#ifndef RPC_M2S_BUFFER_SIZE
+#    define RPC_M2S_BUFFER_SIZE 32
+#endif
+
+enum serial_transaction_id {
+#ifdef SPLIT_TRANSACTION_IDS_USER
+    SPLIT_TRANSACTION_IDS_USER,
+#endif
+    NUM_TOTAL_TRANSACTIONS
+};
+
+typedef void (*slave_callback_t)(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer,
+                                 uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+
+void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
+bool transaction_rpc_send(int8_t transaction_id, uint8_t initiator2target_buffer_size,
+                          const void *initiator2target_buffer);
+
+/* wpm */
+
+uint8_t get_current_wpm(void);
+void    set_current_wpm(uint8_t wpm);
+
+/* oled */
+
+#define OLED_DISPLAY_WIDTH 32
+#define OLED_DISPLAY_HEIGHT 128
+#define OLED_MATRIX_SIZE (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH)
+
+void oled_write(const char *data, bool invert);
+void oled_write_ln(const char *data, bool invert);
+void oled_write_P(const char *data, bool invert);
+void oled_write_ln_P(const char *data, bool invert);
+void oled_write_raw(const char *data, uint16_t size);
+void oled_write_raw_P(const char *data, uint16_t size);
+void oled_write_raw_byte(const char data, uint16_t index);
+void oled_write_char(const char data, bool invert);
+void oled_set_cursor(uint8_t col, uint8_t line);
+void oled_advance_page(bool clear_page_remainder);
+void oled_clear(void);
+uint8_t oled_max_lines(void);
+bool oled_on(void);
+bool oled_off(void);
+bool is_oled_on(void);
+bool oled_task_user(void);
+
+// provided by the aurora keyboard code
+void render_logo(void);
+void render_space(void);
+void render_mod_status_ctrl_shift(uint8_t modifiers);
+
+/* rgb matrix */
+
+typedef struct {
+    uint8_t h;
+    uint8_t s;
+    uint8_t v;
+} hsv_t;
+
+typedef struct {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} rgb_t;
+
+#define HSV_WHITE 0, 0, 255
+#define HSV_RED 0, 255, 255
+#define HSV_GOLD 36, 255, 255
+#define HSV_GREEN 85, 255, 255
+#define HSV_BLUE 170, 255, 255
+#define HSV_OFF 0, 0, 0
+#define NO_LED 255
+
+typedef struct {
+    uint8_t matrix_co[MATRIX_ROWS][MATRIX_COLS];
+} led_config_t;
+
+extern led_config_t g_led_config;
+
+#ifndef RGB_MATRIX_LED_PROCESS_LIMIT
+#    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
+#endif
+
+// effect ids built the way upstream does, the keymap's own effects come from its rgb_matrix_user.inc
+enum rgb_matrix_effects {
+    RGB_MATRIX_NONE = 0,
+    RGB_MATRIX_SOLID_COLOR,
+    RGB_MATRIX_BREATHING,
+#ifdef RGB_MATRIX_CUSTOM_USER
+#    define RGB_MATRIX_EFFECT(name, ...) RGB_MATRIX_CUSTOM_##name,
+#    include "rgb_matrix_user.inc"
+#    undef RGB_MATRIX_EFFECT
+#endif
+    RGB_MATRIX_EFFECT_MAX
+};
+
+#ifndef RGB_MATRIX_DEFAULT_MODE
+#    define RGB_MATRIX_DEFAULT_MODE RGB_MATRIX_SOLID_COLOR // upstream's fallback without CYCLE_LEFT_RIGHT
+#endif
+
+typedef struct {
+    uint8_t iter;
+    bool    init;
+} effect_params_t;
+
+#define RGB_MATRIX_USE_LIMITS(min, max)                        \
+    uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * params->iter; \
+    uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;          \
+    if (max > RGB_MATRIX_LED_COUNT) max = RGB_MATRIX_LED_COUNT;
+
+extern uint32_t g_rgb_timer;
+
+uint8_t  scale8(uint8_t i, uint8_t scale);
+uint16_t scale16by8(uint16_t i, uint8_t scale);
+
+rgb_t   hsv_to_rgb(hsv_t hsv);
+uint8_t rgb_matrix_get_mode(void);
+void    rgb_matrix_mode_noeeprom(uint8_t mode);
+uint8_t rgb_matrix_get_speed(void);
+bool    rgb_matrix_check_finished_leds(uint8_t led_idx);
+bool    rgb_matrix_is_enabled(void);
+void    rgb_matrix_enable_noeeprom(void);
+void    rgb_matrix_sethsv_noeeprom(uint8_t hue, uint8_t sat, uint8_t val);
+hsv_t   rgb_matrix_get_hsv(void);
+uint8_t rgb_matrix_get_val(void);
+void    rgb_matrix_increase_val_noeeprom(void);
+void    rgb_matrix_decrease_val_noeeprom(void);
+void    rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+bool    rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
+
+/* gpio */
+
+#define setPinOutput(pin) ((void)(pin))
+#define writePinHigh(pin) ((void)(pin))
+#define writePinLow(pin) ((void)(pin))
+
+/* layout of the aurora lily58: left half rows 0-4, right half rows 5-9, columns in reading order */
+
+// clang-format off
+#define LAYOUT( \
+    L00, L01, L02, L03, L04, L05,           R00, R01, R02, R03, R04, R05, \
+    L10, L11, L12, L13, L14, L15,           R10, R11, R12, R13, R14, R15, \
+    L20, L21, L22, L23, L24, L25,           R20, R21, R22, R23, R24, R25, \
+    L30, L31, L32, L33, L34, L35, L45, R40, R30, R31, R32, R33, R34, R35, \
+                   L41, L42, L43, L44, R41, R42, R43, R44 \
+) { \
+    { L00, L01, L02, L03, L04, L05 }, \
+    { L10, L11, L12, L13, L14, L15 }, \
+    { L20, L21, L22, L23, L24, L25 }, \
+    { L30, L31, L32, L33, L34, L35 }, \
+    { KC_NO, L41, L42, L43, L44, L45 }, \
+    { R00, R01, R02, R03, R04, R05 }, \
+    { R10, R11, R12, R13, R14, R15 }, \
+    { R20, R21, R22, R23, R24, R25 }, \
+    { R30, R31, R32, R33, R34, R35 }, \
+    { R40, R41, R42, R43, R44, KC_NO } \
+}
+// clang-format on
@@ -0,0 +1,2 @@
+// fallback for keymaps without a local secrets.h, the real one is git ignored
+#pragma once
@@ -0,0 +1,67 @@
+# Builds the simulator for a single keymap, see Makefile.
+
+# the rules.mk files add their generated files to generated-files, like QMK every build waits for them
+.DEFAULT_GOAL := all
+.PHONY: generated-files
+
+KEYMAP_ROOT := ../../keyboards/splitkb/aurora/lily58/rev1/keymaps
+KEYMAP_PATH := $(KEYMAP_ROOT)/$(KEYMAP)
+
+# features of the keyboard itself, from its keyboard.json
+RGB_MATRIX_ENABLE := yes
+
+SRC       :=
+OPT_DEFS  :=
+USER_NAME :=
+include $(KEYMAP_PATH)/rules.mk
+
+# the userspace is included after the keymap, the same way QMK does it
+USER_NAME := $(or $(USER_NAME),$(KEYMAP))
+USER_PATH := ../../users/$(USER_NAME)
+-include $(USER_PATH)/rules.mk
+
+ifeq ($(strip $(RGB_MATRIX_CUSTOM_USER)), yes)
+    OPT_DEFS += -DRGB_MATRIX_CUSTOM_USER
+endif
+
+CC     ?= cc
+CFLAGS ?= -O2 -g
+CFLAGS += -std=gnu11 -Wall -Woverride-init -Wno-unused-function -Wno-unused-variable -Wno-unused-but-set-variable
+CFLAGS += -Iinclude -I. -I$(KEYMAP_PATH) -I$(USER_PATH) -DQMK_KEYBOARD_H='"quantum.h"' $(OPT_DEFS)
+CFLAGS += -DKEYMAP_C='"$(abspath $(KEYMAP_PATH)/keymap.c)"' -DSIM_KEYMAP_NAME='"$(KEYMAP)"'
+
+ifneq ($(wildcard $(USER_PATH)/config.h),)
+    CFLAGS += -DSIM_USER_CONFIG='"$(abspath $(USER_PATH)/config.h)"'
+endif
+ifneq ($(CONFIG),)
+    CFLAGS += -DSIM_CONFIG_OVERRIDE='"$(abspath $(CONFIG))"'
+endif
+
+# like QMK's VPATH, a source is taken from the keymap first and the userspace otherwise
+SOURCES := sim_core.c sim_keymap.c sim_rgb.c \
+           $(foreach src,$(SRC),$(firstword $(wildcard $(KEYMAP_PATH)/$(src) $(USER_PATH)/$(src)) $(src)))
+HEADERS := sim.h $(wildcard include/*.h) $(wildcard $(addprefix $(KEYMAP_PATH)/*,.h .inc) $(addprefix $(USER_PATH)/*,.h .inc))
+DEPS    := $(SOURCES) $(HEADERS) $(KEYMAP_PATH)/keymap.c $(wildcard $(KEYMAP_PATH)/rules.mk $(USER_PATH)/rules.mk) $(CONFIG)
+
+all: $(BUILD)/$(KEYMAP)/sim $(BUILD)/$(KEYMAP)/fuzz
+
+# the string sender benchmark needs the packed nkro sender
+ifeq ($(strip $(NKRO_ENABLE)), yes)
+all: $(BUILD)/$(KEYMAP)/sendbench
+endif
+
+$(BUILD)/$(KEYMAP)/sim: sim_main.c $(DEPS) | generated-files
+	mkdir -p $(dir $@)
+	$(CC) $(CFLAGS) -o $@ sim_main.c $(SOURCES)
+
+$(BUILD)/$(KEYMAP)/fuzz: sim_fuzz.c $(DEPS) | generated-files
+	mkdir -p $(dir $@)
+	$(CC) $(CFLAGS) -o $@ sim_fuzz.c $(SOURCES)
+
+$(BUILD)/$(KEYMAP)/bench_strings_nkro.h: bench_strings.h ../nkro_pack.py
+	mkdir -p $(dir $@)
+	python3 ../nkro_pack.py --out $@ bench_strings.h BENCH_OTP BENCH_SENTENCE BENCH_PASSWORD BENCH_COMMAND
+	touch $@
+
+$(BUILD)/$(KEYMAP)/sendbench: sim_send.c $(BUILD)/$(KEYMAP)/bench_strings_nkro.h $(DEPS) | generated-files
+	$(CC) $(CFLAGS) -I$(BUILD)/$(KEYMAP) -o $@ sim_send.c $(SOURCES)
@@ -0,0 +1,76 @@
+// Interface between the trace replayer and the stand-in QMK core.
+#pragma once
+
+#include "quantum.h"
+
+#define SIM_NKRO_BYTES 32
+
+typedef struct {
+    uint32_t time;
+    uint8_t  mods;
+    uint8_t  keys[SIM_NKRO_BYTES]; // nkro bitmap, bit n is keycode n
+} sim_report_t;
+
+typedef struct {
+    uint64_t ns;
+    uint64_t max_ns;
+    uint32_t calls;
+} sim_cost_t;
+
+typedef struct {
+    sim_cost_t process_record_user;
+    sim_cost_t oled_task_user;
+    sim_cost_t rgb_matrix_indicators;
+    sim_cost_t rgb_matrix_frame; // effect and indicators for every led
+    sim_cost_t housekeeping;
+    uint32_t   eeprom_writes; // calls to eeconfig_update_user_datablock
+    uint32_t   eeprom_bytes;  // bytes that actually changed, what wears the flash
+    uint32_t   split_rpcs;    // calls to transaction_rpc_send
+    uint32_t   split_bytes;   // payload of those calls
+    uint32_t   oled_bytes;    // bytes of the oled buffer that changed
+    uint32_t   oled_blocks;   // dirty blocks the driver sends, OLED_MATRIX_SIZE / 16 bytes each
+    uint8_t    oled_max_blocks; // most blocks sent after one oled_task_user
+} sim_stats_t;
+
+typedef struct {
+    // a new keyboard report differs from the previous one
+    void (*report)(const sim_report_t *report);
+    // media, mouse and lighting keycodes that do not end up in the keyboard report
+    void (*extra)(uint32_t time, uint16_t keycode, bool pressed);
+    // an input event reached process_record, possibly after being held back by combos or tap-hold
+    void (*dispatch)(uint32_t event_id, uint32_t time);
+} sim_callbacks_t;
+
+extern sim_stats_t sim_stats;
+// false runs the hooks as the slave half would, e.g. for the slave oled
+extern bool sim_master;
+// false makes host_can_send_nkro report a 6KRO host
+extern bool sim_nkro;
+
+// from sim_keymap.c, which compiles the keymap itself
+extern const uint16_t (*const sim_keymaps)[MATRIX_ROWS][MATRIX_COLS];
+extern const uint8_t  sim_layer_count;
+extern combo_t *const sim_combos;
+extern const uint16_t sim_combo_count;
+
+void     sim_init(const sim_callbacks_t *callbacks, os_variant_t os);
+void     sim_key_event(uint32_t event_id, uint32_t time, keypos_t key, bool pressed);
+void     sim_run_until(uint32_t time);
+uint32_t sim_now(void);
+bool     sim_is_settled(void);
+void     sim_current_report(sim_report_t *report);
+uint64_t sim_clock_ns(void);
+
+const char *sim_keycode_name(uint8_t keycode);
+uint16_t    sim_ascii_to_keycode(char c); // the keycode SEND_STRING types a character with, shifted ones with S()
+bool        sim_parse_os(const char *name, os_variant_t *os);
+void        sim_print_report(const sim_report_t *report);
+
+// instructions retired between start and stop, stop returns -1 when perf_event_open is unavailable
+void    sim_insn_open(void);
+bool    sim_insn_available(void);
+void    sim_insn_start(void);
+int64_t sim_insn_stop(void);
+
+// from sim_rgb.c, renders one chunk of the current effect and returns true while chunks are left
+bool sim_rgb_effect(effect_params_t *params);
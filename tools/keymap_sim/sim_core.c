@@ -0,0 +1,1547 @@
+// Stand-in for the QMK action layer: combos, tap-hold, one shot mods, caps word, layers and the keyboard report.
+// It follows the default upstream behaviour closely enough to compare configs, it is not a cycle accurate port.
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+#include "sim.h"
+
+#define WAITING_BUFFER_SIZE 16
+#define COMBO_BUFFER_SIZE 8
+
+typedef struct {
+    uint32_t id;
+    uint32_t time;
+    keypos_t key;
+    bool     pressed;
+    uint16_t keycode; // set for records that do not come from the matrix, e.g. combos
+} sim_event_t;
+
+sim_stats_t   sim_stats;
+bool          sim_master          = true;
+bool          sim_nkro            = true;
+layer_state_t layer_state         = 0;
+layer_state_t default_layer_state = 1;
+bool          debug_enable        = false;
+bool          debug_keyboard      = false;
+bool          debug_matrix        = false;
+led_config_t  g_led_config;
+
+static sim_callbacks_t callbacks;
+static uint32_t        now;
+
+static uint8_t real_mods;
+static uint8_t weak_mods;
+static uint8_t oneshot_mods;
+static uint32_t oneshot_time;
+static uint8_t report_keys[SIM_NKRO_BYTES];
+static sim_report_t last_report;
+
+// keycode and tap count resolved on press, so the release goes to the same action
+static uint16_t pressed_keycode[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  pressed_tap_count[MATRIX_ROWS][MATRIX_COLS];
+
+static bool     osm_held;
+static bool     osm_interrupted;
+static bool     caps_word_active;
+static uint32_t caps_word_time;
+static bool     combos_enabled = true;
+
+static uint32_t last_input_time;
+#if EECONFIG_USER_DATA_SIZE > 0
+static uint8_t eeconfig_user_data[EECONFIG_USER_DATA_SIZE];
+#endif
+
+static os_variant_t host_os;
+static uint8_t      wpm;
+static bool         rgb_enabled = true;
+static hsv_t        rgb_hsv     = {0, 0, RGB_MATRIX_MAXIMUM_BRIGHTNESS};
+static uint8_t      rgb_mode;
+uint32_t            g_rgb_timer;
+
+uint64_t sim_clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void cost_add_ns(sim_cost_t *cost, uint64_t ns) {
+    cost->ns += ns;
+    cost->calls++;
+    if (ns > cost->max_ns) {
+        cost->max_ns = ns;
+    }
+}
+
+static void cost_add(sim_cost_t *cost, uint64_t start) {
+    cost_add_ns(cost, sim_clock_ns() - start);
+}
+
+/* weak defaults for hooks a keymap may leave out */
+
+__attribute__((weak)) bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+__attribute__((weak)) bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+__attribute__((weak)) void post_process_record_user(uint16_t keycode, keyrecord_t *record) {}
+__attribute__((weak)) void keyboard_post_init_user(void) {}
+__attribute__((weak)) void matrix_scan_user(void) {}
+__attribute__((weak)) void matrix_slave_scan_user(void) {}
+__attribute__((weak)) void matrix_io_delay(void) {}
+__attribute__((weak)) void matrix_output_select_delay(void) {}
+__attribute__((weak)) void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+__attribute__((weak)) void housekeeping_task_user(void) {}
+__attribute__((weak)) uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    return TAPPING_TERM;
+}
+__attribute__((weak)) bool get_permissive_hold(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+__attribute__((weak)) char chordal_hold_handedness(keypos_t key) {
+    return key.row < MATRIX_ROWS / 2 ? 'L' : 'R';
+}
+bool get_chordal_hold_default(keyrecord_t *tap_hold_record, keyrecord_t *other_record) {
+    char tap_hold_hand = chordal_hold_handedness(tap_hold_record->event.key);
+    char other_hand    = chordal_hold_handedness(other_record->event.key);
+    return tap_hold_hand == '*' || other_hand == '*' || tap_hold_hand != other_hand;
+}
+__attribute__((weak)) bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t *tap_hold_record,
+                                            uint16_t other_keycode, keyrecord_t *other_record) {
+    return get_chordal_hold_default(tap_hold_record, other_record);
+}
+__attribute__((weak)) bool is_flow_tap_key(uint16_t keycode) {
+    if (get_mods() & (MOD_MASK_CG | MOD_BIT_LALT)) {
+        return false;
+    }
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        keycode &= 0xFF;
+    }
+    switch (keycode) {
+        case KC_SPC:
+        case KC_A ... KC_Z:
+        case KC_DOT:
+        case KC_COMM:
+        case KC_SCLN:
+        case KC_SLSH:
+            return true;
+    }
+    return false;
+}
+__attribute__((weak)) uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_keycode) {
+#ifdef FLOW_TAP_TERM
+    return is_flow_tap_key(keycode) && is_flow_tap_key(prev_keycode) ? FLOW_TAP_TERM : 0;
+#else
+    return 0;
+#endif
+}
+__attribute__((weak)) uint16_t get_combo_term(uint16_t index, combo_t *combo) {
+    return COMBO_TERM;
+}
+__attribute__((weak)) bool caps_word_press_user(uint16_t keycode) {
+    if ((keycode >= KC_A && keycode <= KC_Z) || keycode == KC_MINS) {
+        add_weak_mods(MOD_BIT(KC_LSFT));
+        return true;
+    }
+    return (keycode >= KC_1 && keycode <= KC_0) || keycode == KC_BSPC || keycode == KC_DEL || keycode == KC_UNDS;
+}
+__attribute__((weak)) void caps_word_set_user(bool active) {}
+__attribute__((weak)) bool process_detected_host_os_user(os_variant_t detected_os) {
+    return true;
+}
+__attribute__((weak)) bool oled_task_user(void) {
+    return true;
+}
+__attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    return true;
+}
+__attribute__((weak)) layer_state_t layer_state_set_user(layer_state_t state) {
+    return state;
+}
+__attribute__((weak)) layer_state_t default_layer_state_set_user(layer_state_t state) {
+    return state;
+}
+
+/* aurora keyboard level oled helpers */
+
+void render_logo(void) {}
+void render_space(void) {}
+void render_mod_status_ctrl_shift(uint8_t modifiers) {}
+
+/* timer */
+
+uint16_t timer_read(void) {
+    return (uint16_t)now;
+}
+uint32_t timer_read32(void) {
+    return now;
+}
+uint16_t timer_elapsed(uint16_t last) {
+    return TIMER_DIFF_16(timer_read(), last);
+}
+uint32_t timer_elapsed32(uint32_t last) {
+    return TIMER_DIFF_32(now, last);
+}
+/* deferred executor */
+
+typedef struct {
+    deferred_token         token;
+    uint32_t               trigger_time;
+    deferred_exec_callback callback;
+    void                  *cb_arg;
+} sim_deferred_t;
+
+static sim_deferred_t deferred[MAX_DEFERRED_EXECUTORS];
+static deferred_token last_token;
+
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    if (!delay_ms || !callback) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+    for (uint8_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        if (deferred[i].token == INVALID_DEFERRED_TOKEN) {
+            if (++last_token == INVALID_DEFERRED_TOKEN) {
+                last_token++;
+            }
+            deferred[i] = (sim_deferred_t){last_token, now + delay_ms, callback, cb_arg};
+            return last_token;
+        }
+    }
+    return INVALID_DEFERRED_TOKEN;
+}
+
+bool cancel_deferred_exec(deferred_token token) {
+    for (uint8_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        if (token != INVALID_DEFERRED_TOKEN && deferred[i].token == token) {
+            deferred[i].token = INVALID_DEFERRED_TOKEN;
+            return true;
+        }
+    }
+    return false;
+}
+
+// a callback returns the delay to the next call, counted from when it was due, or 0 to stop
+static void deferred_exec_task(void) {
+    for (uint8_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        sim_deferred_t *entry = &deferred[i];
+        if (entry->token != INVALID_DEFERRED_TOKEN && TIMER_DIFF_32(now, entry->trigger_time) < UINT32_MAX / 2) {
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+            if (delay_ms) {
+                entry->trigger_time += delay_ms;
+            } else {
+                entry->token = INVALID_DEFERRED_TOKEN;
+            }
+        }
+    }
+}
+
+uint32_t sim_now(void) {
+    return now;
+}
+
+/* console */
+
+int8_t sendchar(uint8_t c) {
+    return fputc(c, stderr) == EOF ? -1 : 0;
+}
+
+/* eeprom */
+
+#if EECONFIG_USER_DATA_SIZE > 0
+void eeconfig_read_user_datablock(void *data, uint8_t offset, uint8_t length) {
+    memcpy(data, eeconfig_user_data + offset, length);
+}
+
+void eeconfig_update_user_datablock(const void *data, uint8_t offset, uint8_t length) {
+    // like upstream only differing bytes are written
+    sim_stats.eeprom_writes++;
+    for (uint8_t i = 0; i < length; i++) {
+        if (eeconfig_user_data[offset + i] != ((const uint8_t *)data)[i]) {
+            eeconfig_user_data[offset + i] = ((const uint8_t *)data)[i];
+            sim_stats.eeprom_bytes++;
+        }
+    }
+}
+#endif
+
+uint32_t last_input_activity_elapsed(void) {
+    return TIMER_DIFF_32(now, last_input_time);
+}
+
+/* layers */
+
+uint8_t get_highest_layer(layer_state_t state) {
+    return state ? 31 - __builtin_clz(state) : 0;
+}
+
+static void layer_state_set(layer_state_t state) {
+    layer_state = layer_state_set_user(state);
+}
+
+void layer_on(uint8_t layer) {
+    layer_state_set(layer_state | ((layer_state_t)1 << layer));
+}
+
+void layer_off(uint8_t layer) {
+    layer_state_set(layer_state & ~((layer_state_t)1 << layer));
+}
+
+bool layer_state_is(uint8_t layer) {
+    return layer_state & ((layer_state_t)1 << layer);
+}
+
+void default_layer_set(layer_state_t state) {
+    default_layer_state = default_layer_state_set_user(state);
+}
+
+void set_single_persistent_default_layer(uint8_t layer) {
+    default_layer_set((layer_state_t)1 << layer);
+}
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+    if (layer >= sim_layer_count || key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return KC_NO;
+    }
+    return sim_keymaps[layer][key.row][key.col];
+}
+
+static uint16_t layer_keycode(keypos_t key) {
+    layer_state_t state = layer_state | default_layer_state;
+    for (int8_t layer = 31; layer >= 0; layer--) {
+        if (state & ((layer_state_t)1 << layer)) {
+            uint16_t keycode = keymap_key_to_keycode(layer, key);
+            if (keycode != KC_TRANSPARENT) {
+                return keycode;
+            }
+        }
+    }
+    return KC_NO;
+}
+
+/* mods and report */
+
+uint8_t get_mods(void) {
+    return real_mods;
+}
+void add_mods(uint8_t mods) {
+    real_mods |= mods;
+}
+void del_mods(uint8_t mods) {
+    real_mods &= ~mods;
+}
+void set_mods(uint8_t mods) {
+    real_mods = mods;
+}
+void clear_mods(void) {
+    real_mods = 0;
+}
+uint8_t get_weak_mods(void) {
+    return weak_mods;
+}
+void add_weak_mods(uint8_t mods) {
+    weak_mods |= mods;
+}
+void del_weak_mods(uint8_t mods) {
+    weak_mods &= ~mods;
+}
+void set_weak_mods(uint8_t mods) {
+    weak_mods = mods;
+}
+void clear_weak_mods(void) {
+    weak_mods = 0;
+}
+void register_mods(uint8_t mods) {
+    add_mods(mods);
+    send_keyboard_report();
+}
+void unregister_mods(uint8_t mods) {
+    del_mods(mods);
+    send_keyboard_report();
+}
+void register_weak_mods(uint8_t mods) {
+    add_weak_mods(mods);
+    send_keyboard_report();
+}
+void unregister_weak_mods(uint8_t mods) {
+    del_weak_mods(mods);
+    send_keyboard_report();
+}
+uint8_t get_oneshot_mods(void) {
+    return oneshot_mods;
+}
+void add_oneshot_mods(uint8_t mods) {
+    oneshot_mods |= mods;
+    oneshot_time = now;
+}
+void del_oneshot_mods(uint8_t mods) {
+    oneshot_mods &= ~mods;
+}
+void set_oneshot_mods(uint8_t mods) {
+    oneshot_mods = mods;
+    oneshot_time = now;
+}
+void clear_oneshot_mods(void) {
+    oneshot_mods = 0;
+}
+
+void add_key(uint8_t key) {
+    report_keys[key >> 3] |= 1 << (key & 7);
+}
+void del_key(uint8_t key) {
+    report_keys[key >> 3] &= ~(1 << (key & 7));
+}
+void clear_keys(void) {
+    memset(report_keys, 0, sizeof(report_keys));
+}
+
+static bool has_anykey(void) {
+    for (uint8_t i = 0; i < SIM_NKRO_BYTES; i++) {
+        if (report_keys[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void sim_current_report(sim_report_t *report) {
+    report->time = now;
+    report->mods = real_mods | weak_mods | oneshot_mods;
+    memcpy(report->keys, report_keys, sizeof(report->keys));
+}
+
+/* host driver */
+
+static void sim_send(uint8_t mods, const uint8_t *keys) {
+    if (callbacks.report) {
+        sim_report_t report = {.time = now, .mods = mods};
+        memcpy(report.keys, keys, NKRO_REPORT_BITS);
+        callbacks.report(&report);
+    }
+}
+
+static void sim_send_nkro(report_nkro_t *report) {
+    sim_send(report->mods, report->bits);
+}
+
+static void sim_send_keyboard(report_keyboard_t *report) {
+    uint8_t keys[NKRO_REPORT_BITS] = {0};
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i]) {
+            keys[report->keys[i] >> 3] |= 1 << (report->keys[i] & 7);
+        }
+    }
+    sim_send(report->mods, keys);
+}
+
+static host_driver_t  sim_driver  = {.send_keyboard = sim_send_keyboard, .send_nkro = sim_send_nkro};
+static host_driver_t *host_driver = &sim_driver;
+
+host_driver_t *host_get_driver(void) {
+    return host_driver;
+}
+
+void host_set_driver(host_driver_t *driver) {
+    host_driver = driver;
+}
+
+void send_keyboard_report(void) {
+    sim_report_t report;
+    report.time = now;
+    report.mods = real_mods | weak_mods;
+    if (oneshot_mods) {
+        report.mods |= oneshot_mods;
+        if (has_anykey()) {
+            clear_oneshot_mods();
+        }
+    }
+    memcpy(report.keys, report_keys, sizeof(report.keys));
+    if (report.mods == last_report.mods && memcmp(report.keys, last_report.keys, sizeof(report.keys)) == 0) {
+        return;
+    }
+    last_report = report;
+    if (sim_nkro) {
+        report_nkro_t nkro = {.mods = report.mods};
+        memcpy(nkro.bits, report.keys, sizeof(nkro.bits));
+        host_driver->send_nkro(&nkro);
+    } else {
+        // the first keys of the bitmap, where upstream keeps them in the order they were added
+        report_keyboard_t keyboard = {.mods = report.mods};
+        uint8_t           count    = 0;
+        for (uint16_t keycode = 0; keycode < NKRO_REPORT_BITS * 8 && count < KEYBOARD_REPORT_KEYS; keycode++) {
+            if (report.keys[keycode >> 3] & (1 << (keycode & 7))) {
+                keyboard.keys[count++] = keycode;
+            }
+        }
+        host_driver->send_keyboard(&keyboard);
+    }
+}
+
+void clear_keyboard(void) {
+    clear_mods();
+    clear_weak_mods();
+    clear_keys();
+    send_keyboard_report();
+}
+
+/* basic actions */
+
+static uint8_t mods_5bit_to_8bit(uint8_t mods) {
+    return (mods & 0x10) ? (uint8_t)((mods & 0x0F) << 4) : (uint8_t)(mods & 0x0F);
+}
+
+void register_code(uint8_t code) {
+    if (IS_MODIFIER_KEYCODE(code)) {
+        add_mods(MOD_BIT(code));
+        send_keyboard_report();
+    } else if (IS_BASIC_KEYCODE(code)) {
+        add_key(code);
+        send_keyboard_report();
+    } else if (code != KC_NO && callbacks.extra) {
+        callbacks.extra(now, code, true);
+    }
+}
+
+void unregister_code(uint8_t code) {
+    if (IS_MODIFIER_KEYCODE(code)) {
+        del_mods(MOD_BIT(code));
+        send_keyboard_report();
+    } else if (IS_BASIC_KEYCODE(code)) {
+        del_key(code);
+        send_keyboard_report();
+    } else if (code != KC_NO && callbacks.extra) {
+        callbacks.extra(now, code, false);
+    }
+}
+
+void tap_code(uint8_t code) {
+    register_code(code);
+    unregister_code(code);
+}
+
+void register_code16(uint16_t code) {
+    uint8_t mods = mods_5bit_to_8bit(QK_MODS_GET_MODS(code));
+    if (mods) {
+        if (IS_MODIFIER_KEYCODE(code & 0xFF) || (code & 0xFF) == KC_NO) {
+            register_mods(mods);
+        } else {
+            register_weak_mods(mods);
+        }
+    }
+    register_code(code & 0xFF);
+}
+
+void unregister_code16(uint16_t code) {
+    unregister_code(code & 0xFF);
+    uint8_t mods = mods_5bit_to_8bit(QK_MODS_GET_MODS(code));
+    if (mods) {
+        if (IS_MODIFIER_KEYCODE(code & 0xFF) || (code & 0xFF) == KC_NO) {
+            unregister_mods(mods);
+        } else {
+            unregister_weak_mods(mods);
+        }
+    }
+}
+
+void tap_code16(uint16_t code) {
+    register_code16(code);
+    unregister_code16(code);
+}
+
+uint16_t sim_ascii_to_keycode(char c) {
+    static const char     unshifted[] = "\n\t -=[]\\;'`,./";
+    static const uint8_t  unshifted_kc[] = {KC_ENT,  KC_TAB,  KC_SPC,  KC_MINS, KC_EQL,  KC_LBRC, KC_RBRC,
+                                            KC_BSLS, KC_SCLN, KC_QUOT, KC_GRV,  KC_COMM, KC_DOT,  KC_SLSH};
+    static const char     shifted[]      = "!@#$%^&*()_+{}|:\"~<>?";
+    static const uint16_t shifted_kc[]   = {KC_EXLM, KC_AT,   KC_HASH, KC_DLR,  KC_PERC, KC_CIRC, KC_AMPR,
+                                            KC_ASTR, KC_LPRN, KC_RPRN, KC_UNDS, KC_PLUS, KC_LCBR, KC_RCBR,
+                                            KC_PIPE, KC_COLN, KC_DQUO, KC_TILD, KC_LT,   KC_GT,   KC_QUES};
+    if (c >= 'a' && c <= 'z') return KC_A + (c - 'a');
+    if (c >= 'A' && c <= 'Z') return S(KC_A + (c - 'A'));
+    if (c >= '1' && c <= '9') return KC_1 + (c - '1');
+    if (c == '0') return KC_0;
+    for (uint8_t i = 0; unshifted[i]; i++) {
+        if (unshifted[i] == c) return unshifted_kc[i];
+    }
+    for (uint8_t i = 0; shifted[i]; i++) {
+        if (shifted[i] == c) return shifted_kc[i];
+    }
+    return KC_NO;
+}
+
+// like QMK's send_char: shift gets reports of its own around the key
+void send_string(const char *str) {
+    for (; *str; str++) {
+        uint16_t keycode = sim_ascii_to_keycode(*str);
+        bool     shifted = QK_MODS_GET_MODS(keycode) & MOD_LSFT;
+        if ((keycode & 0xFF) == KC_NO) {
+            continue;
+        }
+        if (shifted) {
+            register_code(KC_LSFT);
+        }
+        tap_code(keycode & 0xFF);
+        if (shifted) {
+            unregister_code(KC_LSFT);
+        }
+    }
+}
+
+bool host_can_send_nkro(void) {
+    return sim_nkro;
+}
+
+/* caps word */
+
+void caps_word_on(void) {
+    if (caps_word_active) {
+        return;
+    }
+    clear_mods();
+    clear_oneshot_mods();
+    caps_word_active = true;
+    caps_word_time   = now;
+    caps_word_set_user(true);
+}
+
+void caps_word_off(void) {
+    if (!caps_word_active) {
+        return;
+    }
+    unregister_weak_mods(MOD_MASK_SHIFT);
+    caps_word_active = false;
+    caps_word_set_user(false);
+}
+
+void caps_word_toggle(void) {
+    if (caps_word_active) {
+        caps_word_off();
+    } else {
+        caps_word_on();
+    }
+}
+
+bool is_caps_word_on(void) {
+    return caps_word_active;
+}
+
+static bool process_caps_word(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == QK_CAPS_WORD_TOGGLE) {
+        if (record->event.pressed) {
+            caps_word_toggle();
+        }
+        return false;
+    }
+#ifdef BOTH_SHIFTS_TURNS_ON_CAPS_WORD
+    if (!caps_word_active && record->event.pressed && (keycode == KC_LSFT || keycode == KC_RSFT) &&
+        ((get_mods() | MOD_BIT(keycode)) & MOD_MASK_SHIFT) == MOD_MASK_SHIFT) {
+        caps_word_on();
+        return false;
+    }
+#endif
+    if (!caps_word_active || !record->event.pressed) {
+        return true;
+    }
+    caps_word_time = now;
+    if (IS_MODIFIER_KEYCODE(keycode) || IS_QK_MOMENTARY(keycode) || IS_QK_ONE_SHOT_MOD(keycode)) {
+        return true;
+    }
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        if (record->tap.count == 0) {
+            return true;
+        }
+        keycode &= 0xFF;
+    }
+    clear_weak_mods();
+    if (caps_word_press_user(keycode)) {
+        send_keyboard_report();
+        return true;
+    }
+    caps_word_off();
+    return true;
+}
+
+/* quantum keycodes handled by the core */
+
+static bool process_quantum_keycode(uint16_t keycode, keyrecord_t *record) {
+    if (IS_QK_PERSISTENT_DEF_LAYER(keycode)) {
+        if (record->event.pressed) {
+            set_single_persistent_default_layer(QK_PERSISTENT_DEF_LAYER_GET_LAYER(keycode));
+        }
+        return false;
+    }
+    if (keycode == QK_DEBUG_TOGGLE) {
+        if (record->event.pressed) {
+            debug_enable = !debug_enable;
+        }
+        return false;
+    }
+    if (keycode >= QK_LIGHTING && keycode <= QK_LIGHTING_MAX) {
+        if (record->event.pressed) {
+            switch (keycode) {
+                case QK_RGB_MATRIX_TOGGLE:
+                case QK_UNDERGLOW_TOGGLE:
+                    rgb_enabled = !rgb_enabled;
+                    break;
+                case QK_RGB_MATRIX_MODE_NEXT:
+                    rgb_mode = rgb_mode + 1 < RGB_MATRIX_EFFECT_MAX ? rgb_mode + 1 : RGB_MATRIX_NONE + 1;
+                    break;
+                case QK_RGB_MATRIX_HUE_UP:
+                case QK_UNDERGLOW_HUE_UP:
+                    rgb_hsv.h += 8;
+                    break;
+                case QK_RGB_MATRIX_VALUE_UP:
+                case QK_UNDERGLOW_VALUE_UP:
+                    rgb_matrix_increase_val_noeeprom();
+                    break;
+            }
+            if (callbacks.extra) {
+                callbacks.extra(now, keycode, true);
+            }
+        }
+        return false;
+    }
+    if (keycode >= QK_QUANTUM && keycode <= QK_QUANTUM_MAX) {
+        // bootloader, eeprom clear and friends have no meaning on the host
+        if (record->event.pressed && callbacks.extra) {
+            callbacks.extra(now, keycode, true);
+        }
+        return false;
+    }
+    return true;
+}
+
+/* process_action */
+
+static void process_action(uint16_t keycode, keyrecord_t *record) {
+    bool    pressed   = record->event.pressed;
+    uint8_t tap_count = record->tap.count;
+
+    if (pressed && osm_held && !IS_QK_ONE_SHOT_MOD(keycode)) {
+        osm_interrupted = true;
+    }
+
+    if (keycode <= 0xFF) {
+        if (pressed) {
+            register_code(keycode);
+        } else {
+            unregister_code(keycode);
+        }
+    } else if (IS_QK_MODS(keycode)) {
+        if (pressed) {
+            register_code16(keycode);
+        } else {
+            unregister_code16(keycode);
+        }
+    } else if (IS_QK_MOD_TAP(keycode)) {
+        if (tap_count > 0) {
+            if (pressed) {
+                register_code(QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
+            } else {
+                unregister_code(QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
+            }
+        } else {
+            uint8_t mods = mods_5bit_to_8bit(QK_MOD_TAP_GET_MODS(keycode));
+            if (pressed) {
+                register_mods(mods);
+            } else {
+                unregister_mods(mods);
+            }
+        }
+    } else if (IS_QK_LAYER_TAP(keycode)) {
+        if (tap_count > 0) {
+            if (pressed) {
+                register_code(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
+            } else {
+                unregister_code(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
+            }
+        } else if (pressed) {
+            layer_on(QK_LAYER_TAP_GET_LAYER(keycode));
+        } else {
+            layer_off(QK_LAYER_TAP_GET_LAYER(keycode));
+        }
+    } else if (IS_QK_MOMENTARY(keycode)) {
+        if (pressed) {
+            layer_on(QK_MOMENTARY_GET_LAYER(keycode));
+        } else {
+            layer_off(QK_MOMENTARY_GET_LAYER(keycode));
+        }
+    } else if (IS_QK_ONE_SHOT_MOD(keycode)) {
+        uint8_t mods = mods_5bit_to_8bit(QK_ONE_SHOT_MOD_GET_MODS(keycode));
+        if (pressed) {
+            osm_held        = true;
+            osm_interrupted = false;
+            register_mods(mods);
+        } else {
+            osm_held = false;
+            del_mods(mods);
+            if (!osm_interrupted) {
+                add_oneshot_mods(mods);
+            }
+            send_keyboard_report();
+        }
+    } else if (callbacks.extra) {
+        callbacks.extra(now, keycode, pressed);
+    }
+}
+
+/* process_record */
+
+static void process_record(sim_event_t *event, uint8_t tap_count) {
+    keyrecord_t record = {
+        .event   = {.key = event->key, .time = (uint16_t)event->time, .pressed = event->pressed},
+        .tap     = {.count = tap_count},
+        .keycode = event->keycode,
+    };
+    uint8_t  row = event->key.row;
+    uint8_t  col = event->key.col;
+    uint16_t keycode;
+
+    if (callbacks.dispatch) {
+        callbacks.dispatch(event->id, now);
+    }
+
+    if (event->keycode) {
+        keycode = event->keycode;
+    } else if (event->pressed) {
+        if (!pressed_keycode[row][col]) {
+            pressed_keycode[row][col] = layer_keycode(event->key);
+        }
+        keycode = pressed_keycode[row][col];
+    } else {
+        keycode                   = pressed_keycode[row][col];
+        pressed_keycode[row][col] = 0;
+    }
+
+    if (event->pressed) {
+        // weak mods only live as long as the key that set them is the last one pressed
+        clear_weak_mods();
+    }
+
+    bool     cont;
+    uint64_t start = sim_clock_ns();
+    cont           = process_caps_word(keycode, &record) && process_record_user(keycode, &record);
+    cost_add(&sim_stats.process_record_user, start);
+    if (!cont || !process_quantum_keycode(record.keycode ? record.keycode : keycode, &record)) {
+        return;
+    }
+    process_action(record.keycode ? record.keycode : keycode, &record);
+    post_process_record_user(keycode, &record);
+}
+
+/* tap-hold, a single undecided key at a time with the events behind it held back */
+
+static bool        tapping_active;
+static sim_event_t tapping_event;
+static sim_event_t waiting_buffer[WAITING_BUFFER_SIZE];
+static uint8_t     waiting_count;
+
+// the last key press that was acted on, for flow tap
+static uint16_t flow_tap_prev_keycode;
+static uint32_t flow_tap_prev_time;
+
+static void tapping_process(sim_event_t *event);
+
+static keyrecord_t tapping_record(const sim_event_t *event) {
+    return (keyrecord_t){.event = {.key = event->key, .time = (uint16_t)event->time, .pressed = event->pressed}};
+}
+
+#ifdef PERMISSIVE_HOLD
+static bool waiting_has_press(keypos_t key) {
+    for (uint8_t i = 0; i < waiting_count; i++) {
+        if (waiting_buffer[i].pressed && waiting_buffer[i].key.row == key.row && waiting_buffer[i].key.col == key.col) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+static void waiting_replay(void) {
+    sim_event_t pending[WAITING_BUFFER_SIZE];
+    uint8_t     pending_count = waiting_count;
+    memcpy(pending, waiting_buffer, sizeof(pending));
+    waiting_count = 0;
+    for (uint8_t i = 0; i < pending_count; i++) {
+        tapping_process(&pending[i]);
+    }
+}
+
+static void tapping_resolve(uint8_t tap_count) {
+    tapping_active                                                  = false;
+    pressed_tap_count[tapping_event.key.row][tapping_event.key.col] = tap_count;
+    process_record(&tapping_event, tap_count);
+}
+
+static void tapping_process(sim_event_t *event) {
+    uint8_t row = event->key.row;
+    uint8_t col = event->key.col;
+
+    if (tapping_active) {
+        if (!event->pressed && !event->keycode && row == tapping_event.key.row && col == tapping_event.key.col) {
+            // released within the tapping term: tap, then replay whatever got held back
+            tapping_resolve(1);
+            process_record(event, 1);
+            waiting_replay();
+            return;
+        }
+#ifdef CHORDAL_HOLD
+        if (event->pressed && !event->keycode) {
+            // a key on the same hand settles the undecided key as a tap
+            keyrecord_t tap_hold = tapping_record(&tapping_event);
+            keyrecord_t other    = tapping_record(event);
+            if (!get_chordal_hold(pressed_keycode[tapping_event.key.row][tapping_event.key.col], &tap_hold,
+                                  layer_keycode(event->key), &other)) {
+                tapping_resolve(1);
+                waiting_replay();
+                tapping_process(event);
+                return;
+            }
+        }
+#endif
+#ifdef PERMISSIVE_HOLD
+        if (!event->pressed && !event->keycode && waiting_has_press(event->key)) {
+            // another key went down and up while the undecided key was held
+            keyrecord_t record = tapping_record(&tapping_event);
+            if (get_permissive_hold(pressed_keycode[tapping_event.key.row][tapping_event.key.col], &record)) {
+                tapping_resolve(0);
+                waiting_replay();
+                tapping_process(event);
+                return;
+            }
+        }
+#endif
+        if (waiting_count == WAITING_BUFFER_SIZE) {
+            tapping_resolve(0);
+            waiting_replay();
+            tapping_process(event);
+            return;
+        }
+        waiting_buffer[waiting_count++] = *event;
+        return;
+    }
+
+    if (event->pressed && !event->keycode) {
+        uint16_t keycode = layer_keycode(event->key);
+        uint16_t prev_keycode = flow_tap_prev_keycode;
+        uint32_t prev_time    = flow_tap_prev_time;
+        flow_tap_prev_keycode = keycode;
+        flow_tap_prev_time    = event->time;
+        if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+            pressed_keycode[row][col] = keycode;
+            keyrecord_t record        = tapping_record(event);
+            uint16_t    flow_tap_term = get_flow_tap_term(keycode, &record, prev_keycode);
+            if (flow_tap_term && event->time - prev_time < flow_tap_term) {
+                // pressed while typing: a tap straight away
+                pressed_tap_count[row][col] = 1;
+                process_record(event, 1);
+                return;
+            }
+            tapping_active = true;
+            tapping_event  = *event;
+            return;
+        }
+        pressed_tap_count[row][col] = 0;
+    }
+    process_record(event, event->pressed || event->keycode ? 0 : pressed_tap_count[row][col]);
+}
+
+static void tapping_task(void) {
+    if (!tapping_active) {
+        return;
+    }
+    uint8_t     row    = tapping_event.key.row;
+    uint8_t     col    = tapping_event.key.col;
+    keyrecord_t record = {.event = {.key = tapping_event.key, .time = (uint16_t)tapping_event.time, .pressed = true}};
+    if (now - tapping_event.time >= get_tapping_term(pressed_keycode[row][col], &record)) {
+        tapping_resolve(0);
+        waiting_replay();
+    }
+}
+
+/* combos */
+
+static sim_event_t combo_buffer[COMBO_BUFFER_SIZE];
+static uint8_t     combo_buffer_count;
+static bool        combo_fired[MATRIX_ROWS][MATRIX_COLS];
+static int16_t     combo_down = -1;
+
+void combo_enable(void) {
+    combos_enabled = true;
+}
+void combo_disable(void) {
+    combos_enabled = false;
+}
+bool is_combo_enabled(void) {
+    return combos_enabled;
+}
+
+static uint16_t combo_keycode_at(keypos_t key) {
+#ifdef COMBO_ONLY_FROM_LAYER
+    return keymap_key_to_keycode(COMBO_ONLY_FROM_LAYER, key);
+#else
+    return layer_keycode(key);
+#endif
+}
+
+static bool combo_has_key(const combo_t *combo, uint16_t keycode) {
+    for (const uint16_t *key = combo->keys; *key != COMBO_END; key++) {
+        if (*key == keycode) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint8_t combo_key_count(const combo_t *combo) {
+    uint8_t count = 0;
+    for (const uint16_t *key = combo->keys; *key != COMBO_END; key++) {
+        count++;
+    }
+    return count;
+}
+
+// a combo is a candidate while every buffered key is part of it
+static bool combo_is_candidate(const combo_t *combo, const sim_event_t *extra) {
+    for (uint8_t i = 0; i < combo_buffer_count; i++) {
+        if (!combo_has_key(combo, combo_keycode_at(combo_buffer[i].key))) {
+            return false;
+        }
+    }
+    return !extra || combo_has_key(combo, combo_keycode_at(extra->key));
+}
+
+static void combo_flush(void) {
+    sim_event_t pending[COMBO_BUFFER_SIZE];
+    uint8_t     pending_count = combo_buffer_count;
+    memcpy(pending, combo_buffer, sizeof(pending));
+    combo_buffer_count = 0;
+    for (uint8_t i = 0; i < pending_count; i++) {
+        tapping_process(&pending[i]);
+    }
+}
+
+static uint16_t combo_term(void) {
+    uint16_t term = 0;
+    for (uint16_t i = 0; i < sim_combo_count; i++) {
+        if (!sim_combos[i].disabled && combo_is_candidate(&sim_combos[i], NULL)) {
+#ifdef COMBO_TERM_PER_COMBO
+            uint16_t combo_term = get_combo_term(i, &sim_combos[i]);
+#else
+            uint16_t combo_term = COMBO_TERM;
+#endif
+            if (combo_term > term) {
+                term = combo_term;
+            }
+        }
+    }
+    return term;
+}
+
+static void combo_try_fire(void) {
+    int16_t complete = -1;
+    bool    longer   = false;
+    for (uint16_t i = 0; i < sim_combo_count; i++) {
+        if (sim_combos[i].disabled || !combo_is_candidate(&sim_combos[i], NULL)) {
+            continue;
+        }
+        if (combo_key_count(&sim_combos[i]) == combo_buffer_count) {
+            complete = i;
+        } else {
+            longer = true;
+        }
+    }
+    if (complete < 0 || longer) {
+        return;
+    }
+    sim_event_t combo_event = combo_buffer[combo_buffer_count - 1];
+    combo_event.key         = combo_buffer[0].key;
+    combo_event.keycode     = sim_combos[complete].keycode;
+    for (uint8_t i = 0; i < combo_buffer_count; i++) {
+        combo_fired[combo_buffer[i].key.row][combo_buffer[i].key.col] = true;
+        if (callbacks.dispatch) {
+            callbacks.dispatch(combo_buffer[i].id, now);
+        }
+    }
+    combo_buffer_count          = 0;
+    combo_down                  = complete;
+    sim_combos[complete].active = true;
+    tapping_process(&combo_event);
+}
+
+static void combo_process(sim_event_t *event) {
+    uint8_t row = event->key.row;
+    uint8_t col = event->key.col;
+
+    if (!event->pressed) {
+        if (combo_fired[row][col]) {
+            // the first released key releases the combo, the others are swallowed
+            combo_fired[row][col] = false;
+            if (combo_down >= 0) {
+                sim_event_t combo_event = *event;
+                combo_event.keycode     = sim_combos[combo_down].keycode;
+                sim_combos[combo_down].active = false;
+                combo_down                    = -1;
+                tapping_process(&combo_event);
+            } else if (callbacks.dispatch) {
+                callbacks.dispatch(event->id, now);
+            }
+            return;
+        }
+        for (uint8_t i = 0; i < combo_buffer_count; i++) {
+            if (combo_buffer[i].key.row == row && combo_buffer[i].key.col == col) {
+                combo_flush();
+                break;
+            }
+        }
+        tapping_process(event);
+        return;
+    }
+
+    bool in_combo = false;
+    if (combos_enabled) {
+        for (uint16_t i = 0; i < sim_combo_count && !in_combo; i++) {
+            in_combo = !sim_combos[i].disabled && combo_is_candidate(&sim_combos[i], event);
+        }
+    }
+    if (!in_combo) {
+        combo_flush();
+        if (combos_enabled && combo_buffer_count == 0) {
+            for (uint16_t i = 0; i < sim_combo_count && !in_combo; i++) {
+                in_combo = !sim_combos[i].disabled && combo_has_key(&sim_combos[i], combo_keycode_at(event->key));
+            }
+        }
+        if (!in_combo) {
+            tapping_process(event);
+            return;
+        }
+    }
+    if (combo_buffer_count == COMBO_BUFFER_SIZE) {
+        combo_flush();
+    }
+    combo_buffer[combo_buffer_count++] = *event;
+    combo_try_fire();
+}
+
+static void combo_task(void) {
+    if (combo_buffer_count && now - combo_buffer[0].time >= combo_term()) {
+        combo_flush();
+    }
+}
+
+/* split, wpm, os detection */
+
+bool is_keyboard_master(void) {
+    return sim_master;
+}
+bool is_keyboard_left(void) {
+    return true;
+}
+os_variant_t detected_host_os(void) {
+    return host_os;
+}
+void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback) {}
+bool transaction_rpc_send(int8_t transaction_id, uint8_t initiator2target_buffer_size,
+                          const void *initiator2target_buffer) {
+    sim_stats.split_rpcs++;
+    sim_stats.split_bytes += initiator2target_buffer_size;
+    return true;
+}
+uint8_t get_current_wpm(void) {
+    return wpm;
+}
+void set_current_wpm(uint8_t new_wpm) {
+    wpm = new_wpm;
+}
+
+/* oled, a buffer with the driver's dirty blocks so what would be sent to the display is counted. there is no font,
+   the bytes of a character all get its code, which changes them exactly when the character changes */
+
+#define OLED_LINE_BYTES (OLED_MATRIX_SIZE / (OLED_DISPLAY_HEIGHT / 8))
+#define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / 16)
+#define OLED_FONT_WIDTH 6
+
+static uint8_t  oled_buffer[OLED_MATRIX_SIZE];
+static uint16_t oled_cursor;
+static uint16_t oled_dirty; // one bit per block
+
+void oled_write_raw_byte(const char data, uint16_t index) {
+    if (index >= OLED_MATRIX_SIZE || oled_buffer[index] == (uint8_t)data) {
+        return;
+    }
+    oled_buffer[index] = data;
+    oled_dirty |= 1 << (index / OLED_BLOCK_SIZE);
+    sim_stats.oled_bytes++;
+}
+
+void oled_advance_page(bool clear_page_remainder) {
+    uint16_t next = (oled_cursor / OLED_LINE_BYTES + 1) * OLED_LINE_BYTES;
+    if (clear_page_remainder) {
+        for (uint16_t i = oled_cursor; i < next; i++) {
+            oled_write_raw_byte(0, i);
+        }
+    }
+    oled_cursor = next % OLED_MATRIX_SIZE;
+}
+
+void oled_write_char(const char data, bool invert) {
+    if (data == '\n') {
+        oled_advance_page(true);
+        return;
+    }
+    for (uint8_t i = 0; i < OLED_FONT_WIDTH; i++) {
+        oled_write_raw_byte(invert ? ~data : data, oled_cursor + i);
+    }
+    oled_cursor += OLED_FONT_WIDTH;
+    if (oled_cursor % OLED_LINE_BYTES + OLED_FONT_WIDTH > OLED_LINE_BYTES) {
+        oled_advance_page(false);
+    }
+    oled_cursor %= OLED_MATRIX_SIZE;
+}
+
+void oled_write(const char *data, bool invert) {
+    while (*data) {
+        oled_write_char(*data++, invert);
+    }
+}
+void oled_write_ln(const char *data, bool invert) {
+    oled_write(data, invert);
+    oled_advance_page(true);
+}
+void oled_write_P(const char *data, bool invert) {
+    oled_write(data, invert);
+}
+void oled_write_ln_P(const char *data, bool invert) {
+    oled_write_ln(data, invert);
+}
+void oled_write_raw(const char *data, uint16_t size) {
+    for (uint16_t i = 0; i < size; i++) {
+        oled_write_raw_byte(data[i], oled_cursor + i);
+    }
+}
+void oled_write_raw_P(const char *data, uint16_t size) {
+    oled_write_raw(data, size);
+}
+void oled_set_cursor(uint8_t col, uint8_t line) {
+    oled_cursor = (line * OLED_LINE_BYTES + col * OLED_FONT_WIDTH) % OLED_MATRIX_SIZE;
+}
+void oled_clear(void) {
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+        oled_write_raw_byte(0, i);
+    }
+    oled_dirty  = 0xFFFF;
+    oled_cursor = 0;
+}
+uint8_t oled_max_lines(void) {
+    return OLED_DISPLAY_HEIGHT / 8;
+}
+bool oled_on(void) {
+    return true;
+}
+bool oled_off(void) {
+    return false;
+}
+bool is_oled_on(void) {
+    return true;
+}
+
+// what the driver sends after the user hook, every dirty block
+static void oled_render(void) {
+    uint8_t blocks = __builtin_popcount(oled_dirty);
+    sim_stats.oled_blocks += blocks;
+    if (blocks > sim_stats.oled_max_blocks) {
+        sim_stats.oled_max_blocks = blocks;
+    }
+    oled_dirty = 0;
+}
+
+/* rgb matrix */
+
+rgb_t hsv_to_rgb(hsv_t hsv) {
+    rgb_t    rgb;
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h = hsv.h;
+    if (hsv.s == 0) {
+        return (rgb_t){hsv.v, hsv.v, hsv.v};
+    }
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+    p         = (hsv.v * (255 - hsv.s)) >> 8;
+    q         = (hsv.v * (255 - ((hsv.s * remainder) >> 8))) >> 8;
+    t         = (hsv.v * (255 - ((hsv.s * (255 - remainder)) >> 8))) >> 8;
+    switch (region) {
+        case 6:
+        case 0:
+            rgb = (rgb_t){hsv.v, t, p};
+            break;
+        case 1:
+            rgb = (rgb_t){q, hsv.v, p};
+            break;
+        case 2:
+            rgb = (rgb_t){p, hsv.v, t};
+            break;
+        case 3:
+            rgb = (rgb_t){p, q, hsv.v};
+            break;
+        case 4:
+            rgb = (rgb_t){t, p, hsv.v};
+            break;
+        default:
+            rgb = (rgb_t){hsv.v, p, q};
+            break;
+    }
+    return rgb;
+}
+
+bool rgb_matrix_is_enabled(void) {
+    return rgb_enabled;
+}
+void rgb_matrix_enable_noeeprom(void) {
+    rgb_enabled = true;
+}
+void rgb_matrix_sethsv_noeeprom(uint8_t hue, uint8_t sat, uint8_t val) {
+    rgb_hsv = (hsv_t){hue, sat, val > RGB_MATRIX_MAXIMUM_BRIGHTNESS ? RGB_MATRIX_MAXIMUM_BRIGHTNESS : val};
+}
+hsv_t rgb_matrix_get_hsv(void) {
+    return rgb_hsv;
+}
+uint8_t rgb_matrix_get_val(void) {
+    return rgb_hsv.v;
+}
+void rgb_matrix_increase_val_noeeprom(void) {
+    rgb_hsv.v = rgb_hsv.v + RGB_MATRIX_VAL_STEP > RGB_MATRIX_MAXIMUM_BRIGHTNESS ? RGB_MATRIX_MAXIMUM_BRIGHTNESS
+                                                                                : rgb_hsv.v + RGB_MATRIX_VAL_STEP;
+}
+void rgb_matrix_decrease_val_noeeprom(void) {
+    rgb_hsv.v = rgb_hsv.v > RGB_MATRIX_VAL_STEP ? rgb_hsv.v - RGB_MATRIX_VAL_STEP : 0;
+}
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {}
+uint8_t rgb_matrix_get_mode(void) {
+    return rgb_mode;
+}
+void rgb_matrix_mode_noeeprom(uint8_t mode) {
+    rgb_mode = mode;
+}
+uint8_t rgb_matrix_get_speed(void) {
+    return 128;
+}
+bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
+    return led_idx < RGB_MATRIX_LED_COUNT;
+}
+uint8_t scale8(uint8_t i, uint8_t scale) {
+    return ((uint16_t)i * (1 + scale)) >> 8;
+}
+uint16_t scale16by8(uint16_t i, uint8_t scale) {
+    return ((uint32_t)i * (1 + scale)) >> 8;
+}
+
+/* main loop */
+
+void sim_init(const sim_callbacks_t *cb, os_variant_t os) {
+    callbacks   = *cb;
+    host_os     = os;
+    host_driver = &sim_driver;
+    memset(deferred, 0, sizeof(deferred));
+    rgb_mode    = RGB_MATRIX_DEFAULT_MODE; // what eeconfig_init_rgb_matrix stores in a fresh eeprom
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t index                    = row * MATRIX_COLS + col;
+            g_led_config.matrix_co[row][col] = index < RGB_MATRIX_LED_COUNT ? index : NO_LED;
+        }
+    }
+    keyboard_post_init_user();
+    process_detected_host_os_user(os);
+}
+
+void sim_key_event(uint32_t event_id, uint32_t time, keypos_t key, bool pressed) {
+    sim_run_until(time);
+    last_input_time    = now;
+    sim_event_t event  = {.id = event_id, .time = now, .key = key, .pressed = pressed};
+    keyrecord_t record = {.event = {.key = key, .time = (uint16_t)now, .pressed = pressed}};
+    if (pre_process_record_user(pressed ? layer_keycode(key) : pressed_keycode[key.row][key.col], &record)) {
+        combo_process(&event);
+    }
+}
+
+static void sim_tick(void) {
+    combo_task();
+    tapping_task();
+#if defined(ONESHOT_TIMEOUT) && ONESHOT_TIMEOUT > 0
+    if (oneshot_mods && now - oneshot_time >= ONESHOT_TIMEOUT) {
+        clear_oneshot_mods();
+        send_keyboard_report();
+    }
+#endif
+    if (caps_word_active && now - caps_word_time >= CAPS_WORD_IDLE_TIMEOUT) {
+        caps_word_off();
+    }
+
+    // the rows of this half are read like upstream's matrix does it, the keys themselves come from the trace
+    for (uint8_t row = 0; row < MATRIX_ROWS / 2; row++) {
+        matrix_output_select_delay();
+        matrix_output_unselect_delay(row, false);
+    }
+    uint64_t start = sim_clock_ns();
+    if (sim_master) {
+        matrix_scan_user();
+    } else {
+        matrix_slave_scan_user();
+    }
+    housekeeping_task_user();
+    cost_add(&sim_stats.housekeeping, start);
+    deferred_exec_task();
+
+    if (now % OLED_UPDATE_INTERVAL == 0) {
+        start = sim_clock_ns();
+        oled_task_user();
+        cost_add(&sim_stats.oled_task_user, start);
+        oled_render();
+    }
+    if (now % RGB_MATRIX_LED_FLUSH_LIMIT == 0 && rgb_enabled) {
+        // one frame: every chunk of the effect, each followed by the indicators for the same chunk
+        uint64_t         effect_ns     = 0;
+        uint64_t         indicators_ns = 0;
+        effect_params_t  frame         = {.iter = 0, .init = false};
+        effect_params_t *params        = &frame;
+        g_rgb_timer                    = now;
+        for (bool more = true; more; params->iter++) {
+            start = sim_clock_ns();
+            more  = sim_rgb_effect(params);
+            effect_ns += sim_clock_ns() - start;
+            RGB_MATRIX_USE_LIMITS(led_min, led_max);
+            start = sim_clock_ns();
+            rgb_matrix_indicators_advanced_user(led_min, led_max);
+            indicators_ns += sim_clock_ns() - start;
+        }
+        cost_add_ns(&sim_stats.rgb_matrix_indicators, indicators_ns);
+        cost_add_ns(&sim_stats.rgb_matrix_frame, effect_ns + indicators_ns);
+    }
+}
+
+void sim_run_until(uint32_t time) {
+    while (now < time) {
+        now++;
+        sim_tick();
+    }
+}
+
+bool sim_is_settled(void) {
+    return !tapping_active && waiting_count == 0 && combo_buffer_count == 0;
+}
+
+bool sim_parse_os(const char *name, os_variant_t *os) {
+    static const struct {
+        const char  *name;
+        os_variant_t os;
+    } names[] = {
+        {"unsure", OS_UNSURE}, {"linux", OS_LINUX}, {"windows", OS_WINDOWS}, {"macos", OS_MACOS}, {"ios", OS_IOS},
+    };
+    for (size_t i = 0; i < ARRAY_SIZE(names); i++) {
+        if (strcmp(name, names[i].name) == 0) {
+            *os = names[i].os;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* instruction counts, via perf_event_open when the kernel allows it */
+
+static int perf_fd = -1;
+
+void sim_insn_open(void) {
+    struct perf_event_attr attr = {
+        .type           = PERF_TYPE_HARDWARE,
+        .size           = sizeof(attr),
+        .config         = PERF_COUNT_HW_INSTRUCTIONS,
+        .disabled       = 1,
+        .exclude_kernel = 1,
+        .exclude_hv     = 1,
+    };
+    perf_fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+void sim_insn_start(void) {
+    if (perf_fd >= 0) {
+        ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+int64_t sim_insn_stop(void) {
+    int64_t count = -1;
+    if (perf_fd >= 0) {
+        ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(perf_fd, &count, sizeof(count)) != sizeof(count)) {
+            count = -1;
+        }
+    }
+    return count;
+}
+
+bool sim_insn_available(void) {
+    return perf_fd >= 0;
+}
+
+/* names for the report output */
+
+const char *sim_keycode_name(uint8_t keycode) {
+    static const char *const names[] = {
+        [KC_A] = "a",         [KC_B] = "b",         [KC_C] = "c",        [KC_D] = "d",        [KC_E] = "e",
+        [KC_F] = "f",         [KC_G] = "g",         [KC_H] = "h",        [KC_I] = "i",        [KC_J] = "j",
+        [KC_K] = "k",         [KC_L] = "l",         [KC_M] = "m",        [KC_N] = "n",        [KC_O] = "o",
+        [KC_P] = "p",         [KC_Q] = "q",         [KC_R] = "r",        [KC_S] = "s",        [KC_T] = "t",
+        [KC_U] = "u",         [KC_V] = "v",         [KC_W] = "w",        [KC_X] = "x",        [KC_Y] = "y",
+        [KC_Z] = "z",         [KC_1] = "1",         [KC_2] = "2",        [KC_3] = "3",        [KC_4] = "4",
+        [KC_5] = "5",         [KC_6] = "6",         [KC_7] = "7",        [KC_8] = "8",        [KC_9] = "9",
+        [KC_0] = "0",         [KC_ENT] = "ent",     [KC_ESC] = "esc",    [KC_BSPC] = "bspc",  [KC_TAB] = "tab",
+        [KC_SPC] = "spc",     [KC_MINS] = "mins",   [KC_EQL] = "eql",    [KC_LBRC] = "lbrc",  [KC_RBRC] = "rbrc",
+        [KC_BSLS] = "bsls",   [KC_SCLN] = "scln",   [KC_QUOT] = "quot",  [KC_GRV] = "grv",    [KC_COMM] = "comm",
+        [KC_DOT] = "dot",     [KC_SLSH] = "slsh",   [KC_CAPS] = "caps",  [KC_F1] = "f1",      [KC_F2] = "f2",
+        [KC_F3] = "f3",       [KC_F4] = "f4",       [KC_F5] = "f5",      [KC_F6] = "f6",      [KC_F7] = "f7",
+        [KC_F8] = "f8",       [KC_F9] = "f9",       [KC_F10] = "f10",    [KC_F11] = "f11",    [KC_F12] = "f12",
+        [KC_HOME] = "home",   [KC_PGUP] = "pgup",   [KC_DEL] = "del",    [KC_END] = "end",    [KC_PGDN] = "pgdn",
+        [KC_RGHT] = "rght",   [KC_LEFT] = "left",   [KC_DOWN] = "down",  [KC_UP] = "up",      [KC_APP] = "app",
+        [KC_MUTE] = "mute",   [KC_VOLU] = "volu",   [KC_VOLD] = "vold",  [KC_MNXT] = "mnxt",  [KC_MPRV] = "mprv",
+        [KC_MSTP] = "mstp",   [KC_MPLY] = "mply",   [KC_MS_U] = "ms_u",  [KC_MS_D] = "ms_d",  [KC_MS_L] = "ms_l",
+        [KC_MS_R] = "ms_r",   [KC_BTN1] = "btn1",   [KC_BTN2] = "btn2",  [KC_BTN3] = "btn3",  [KC_WH_U] = "wh_u",
+        [KC_WH_D] = "wh_d",   [KC_WH_L] = "wh_l",   [KC_WH_R] = "wh_r",  [KC_LCTL] = "lctl",  [KC_LSFT] = "lsft",
+        [KC_LALT] = "lalt",   [KC_LGUI] = "lgui",   [KC_RCTL] = "rctl",  [KC_RSFT] = "rsft",  [KC_RALT] = "ralt",
+        [KC_RGUI] = "rgui",
+    };
+    if (keycode < ARRAY_SIZE(names) && names[keycode]) {
+        return names[keycode];
+    }
+    return NULL;
+}
+
+void sim_print_report(const sim_report_t *report) {
+    static const char *const mod_names[] = {"lctl", "lsft", "lalt", "lgui", "rctl", "rsft", "ralt", "rgui"};
+    bool                     any         = false;
+
+    printf("%8u report mods=", report->time);
+    for (uint8_t i = 0; i < 8; i++) {
+        if (report->mods & (1 << i)) {
+            printf("%s%s", any ? "|" : "", mod_names[i]);
+            any = true;
+        }
+    }
+    printf("%s keys=", any ? "" : "-");
+    any = false;
+    for (uint16_t keycode = 0; keycode < SIM_NKRO_BYTES * 8; keycode++) {
+        if (report->keys[keycode >> 3] & (1 << (keycode & 7))) {
+            const char *name = sim_keycode_name(keycode);
+            if (name) {
+                printf("%s%s", any ? "," : "", name);
+            } else {
+                printf("%s0x%02X", any ? "," : "", keycode);
+            }
+            any = true;
+        }
+    }
+    printf("%s\n", any ? "" : "-");
+}
@@ -0,0 +1,473 @@
+// Feeds a keymap generated press/release sequences aimed at the edges of its combo and tap-hold windows, and reports
+// the sequences with the most expensive single event, the longest dispatch delay and any that leave mods or keys
+// held after every key was released.
+//
+// Every sequence runs in a forked child, so the keymap and the stand-in core start clean each time and a crash or a
+// hang is a finding like any other. The sequences are printed in the trace format, so they replay with sim.
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "sim.h"
+
+#define MAX_EVENTS 256
+#define MAX_HELD 6
+#define MAX_STUCK 8
+#define WORST_KEPT 8     // the most expensive sequences are run again to see past scheduling noise
+#define COST_REPEATS 5
+#define HANG_SECONDS 5
+#define HOT_WEIGHT 4     // tap-hold, one shot, layer, modifier, combo and custom keys are picked this much more often
+
+#ifndef ONESHOT_TIMEOUT
+#    define ONESHOT_TIMEOUT 0
+#endif
+
+typedef struct {
+    uint32_t time;
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+} fuzz_event_t;
+
+typedef struct {
+    uint32_t     number; // which generated sequence this was
+    uint16_t     count;
+    fuzz_event_t events[MAX_EVENTS];
+} sequence_t;
+
+typedef enum {
+    RUN_OK,
+    RUN_CRASHED,
+    RUN_HUNG,
+} run_status_t;
+
+typedef struct {
+    run_status_t status;
+    int          signal;
+    uint64_t     cost_ns;    // most expensive event
+    int64_t      cost_insn;  // its instructions, -1 without perf_event_open
+    uint16_t     cost_event;
+    uint32_t     delay;      // longest dispatch delay
+    uint16_t     delay_event;
+    uint16_t     undelivered;
+    bool         stuck;
+    uint8_t      oneshot; // one shot mods still armed, in the report until the next key and not stuck
+    sim_report_t final;
+} outcome_t;
+
+typedef struct {
+    sequence_t sequence;
+    outcome_t  outcome;
+    uint32_t   hits; // sequences that ended the same way, before shrinking
+} finding_t;
+
+static os_variant_t os            = OS_UNSURE;
+static int          default_layer = -1;
+
+/* one run, in a child */
+
+static outcome_t *shared;
+static uint32_t   dispatched[MAX_EVENTS];
+
+static void on_dispatch(uint32_t event_id, uint32_t time) {
+    if (event_id < MAX_EVENTS && dispatched[event_id] == UINT32_MAX) {
+        dispatched[event_id] = time;
+    }
+}
+
+static void replay(const sequence_t *sequence, outcome_t *outcome) {
+    sim_callbacks_t callbacks = {.dispatch = on_dispatch};
+    memset(dispatched, 0xFF, sizeof(dispatched));
+    sim_insn_open();
+    sim_init(&callbacks, os);
+    if (default_layer >= 0) {
+        default_layer_set((layer_state_t)1 << default_layer);
+    }
+
+    for (uint16_t i = 0; i < sequence->count; i++) {
+        const fuzz_event_t *event = &sequence->events[i];
+        sim_run_until(event->time);
+        uint64_t start = sim_clock_ns();
+        sim_insn_start();
+        sim_key_event(i, event->time, (keypos_t){.row = event->row, .col = event->col}, event->pressed);
+        int64_t  insn = sim_insn_stop();
+        uint64_t ns   = sim_clock_ns() - start;
+        if (insn >= 0 ? insn > outcome->cost_insn : ns > outcome->cost_ns) {
+            outcome->cost_ns    = ns;
+            outcome->cost_insn  = insn;
+            outcome->cost_event = i;
+        }
+    }
+    uint32_t settle = sim_now() + 1;
+    while (!sim_is_settled() || sim_now() < settle) {
+        sim_run_until(sim_now() + 1);
+    }
+    // every timeout gets to run out, a one shot mod or caps word shift that is still in the report then is stuck
+    static const uint32_t timeouts[] = {TAPPING_TERM, COMBO_TERM, ONESHOT_TIMEOUT, CAPS_WORD_IDLE_TIMEOUT};
+    uint32_t              longest    = 0;
+    for (uint8_t i = 0; i < ARRAY_SIZE(timeouts); i++) {
+        longest = timeouts[i] > longest ? timeouts[i] : longest;
+    }
+    sim_run_until(sim_now() + longest + 1);
+
+    for (uint16_t i = 0; i < sequence->count; i++) {
+        if (dispatched[i] == UINT32_MAX) {
+            outcome->undelivered++;
+        } else if (dispatched[i] - sequence->events[i].time > outcome->delay) {
+            outcome->delay       = dispatched[i] - sequence->events[i].time;
+            outcome->delay_event = i;
+        }
+    }
+    sim_current_report(&outcome->final);
+    outcome->oneshot = get_oneshot_mods();
+    outcome->stuck   = (outcome->final.mods & ~outcome->oneshot) != 0;
+    for (uint8_t i = 0; i < SIM_NKRO_BYTES; i++) {
+        outcome->stuck |= outcome->final.keys[i] != 0;
+    }
+}
+
+static void run(const sequence_t *sequence, outcome_t *outcome) {
+    memset(shared, 0, sizeof(*shared));
+    shared->cost_insn = -1;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    }
+    if (pid == 0) {
+        // the keymap prints to the console, which is stdout here
+        if (!freopen("/dev/null", "w", stdout) || !freopen("/dev/null", "w", stderr)) {
+            _exit(1);
+        }
+        alarm(HANG_SECONDS);
+        replay(sequence, shared);
+        _exit(0);
+    }
+    int status;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR) {
+            perror("waitpid");
+            exit(1);
+        }
+    }
+    *outcome = *shared;
+    if (WIFSIGNALED(status)) {
+        outcome->status = WTERMSIG(status) == SIGALRM ? RUN_HUNG : RUN_CRASHED;
+        outcome->signal = WTERMSIG(status);
+    } else if (WEXITSTATUS(status) != 0) {
+        outcome->status = RUN_CRASHED;
+    }
+}
+
+// instructions where they can be counted, they do not depend on what else the host is doing
+static uint64_t cost_of(const outcome_t *outcome) {
+    return outcome->cost_insn >= 0 ? (uint64_t)outcome->cost_insn : outcome->cost_ns;
+}
+
+/* generating sequences */
+
+static uint32_t rng_state = 1;
+
+static uint32_t rng_below(uint32_t n) {
+    // xorshift32, the same seed gives the same sequences
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state % n;
+}
+
+static keypos_t pool[MATRIX_ROWS * MATRIX_COLS * HOT_WEIGHT];
+static uint16_t pool_size;
+
+static bool is_hot_keycode(uint16_t keycode) {
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode) || IS_QK_ONE_SHOT_MOD(keycode) ||
+        IS_QK_MOMENTARY(keycode) || IS_QK_MODS(keycode) || keycode >= SAFE_RANGE) {
+        return true;
+    }
+    if (keycode >= KC_LCTL && keycode <= KC_RGUI) {
+        return true;
+    }
+    for (uint16_t i = 0; i < sim_combo_count; i++) {
+        for (const uint16_t *key = sim_combos[i].keys; *key != COMBO_END; key++) {
+            if (*key == keycode) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void build_pool(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            bool used = false;
+            bool hot  = false;
+            for (uint8_t layer = 0; layer < sim_layer_count; layer++) {
+                uint16_t keycode = sim_keymaps[layer][row][col];
+                used |= keycode != KC_NO && keycode != KC_TRNS;
+                hot |= is_hot_keycode(keycode);
+            }
+            for (uint8_t i = 0; used && i < (hot ? HOT_WEIGHT : 1); i++) {
+                pool[pool_size++] = (keypos_t){.row = row, .col = col};
+            }
+        }
+    }
+}
+
+static uint32_t next_gap(void) {
+    // mostly right at the edges of the windows the keymap decides in, where an off by one would show
+    static const uint16_t edges[] = {
+        0, 1, COMBO_TERM - 1, COMBO_TERM, COMBO_TERM + 1, TAPPING_TERM - 1, TAPPING_TERM, TAPPING_TERM + 1,
+#ifdef QUICK_TAP_TERM
+        QUICK_TAP_TERM + 1,
+#endif
+#ifdef FLOW_TAP_TERM
+        FLOW_TAP_TERM - 1, FLOW_TAP_TERM, FLOW_TAP_TERM + 1,
+#endif
+    };
+    if (rng_below(4) == 0) {
+        return rng_below(2 * TAPPING_TERM);
+    }
+    return edges[rng_below(ARRAY_SIZE(edges))];
+}
+
+static void push_event(sequence_t *sequence, uint32_t time, keypos_t key, bool pressed) {
+    sequence->events[sequence->count++] = (fuzz_event_t){time, key.row, key.col, pressed};
+}
+
+static void generate(sequence_t *sequence, uint16_t presses) {
+    keypos_t held[MAX_HELD];
+    uint8_t  held_count = 0;
+    uint32_t time       = 0;
+
+    sequence->count = 0;
+    while (presses && sequence->count < MAX_EVENTS - MAX_HELD - 1) {
+        time += next_gap();
+        if (held_count && (held_count == MAX_HELD || rng_below(2))) {
+            uint8_t index = rng_below(held_count);
+            push_event(sequence, time, held[index], false);
+            held[index] = held[--held_count];
+            continue;
+        }
+        keypos_t key     = pool[rng_below(pool_size)];
+        bool     is_held = false;
+        for (uint8_t i = 0; i < held_count; i++) {
+            is_held |= held[i].row == key.row && held[i].col == key.col;
+        }
+        if (!is_held) {
+            push_event(sequence, time, key, true);
+            held[held_count++] = key;
+            presses--;
+        }
+    }
+    while (held_count) {
+        time += next_gap();
+        uint8_t index = rng_below(held_count);
+        push_event(sequence, time, held[index], false);
+        held[index] = held[--held_count];
+    }
+}
+
+/* shrinking */
+
+static bool same_ending(const outcome_t *a, const outcome_t *b) {
+    if (a->status != b->status) {
+        return false;
+    }
+    if (a->status != RUN_OK) {
+        return a->signal == b->signal;
+    }
+    return a->stuck == b->stuck && a->final.mods == b->final.mods &&
+           memcmp(a->final.keys, b->final.keys, sizeof(a->final.keys)) == 0;
+}
+
+// drops presses, with their releases, for as long as the sequence still ends the same way
+static void shrink(finding_t *finding) {
+    for (uint16_t i = 0; i < finding->sequence.count; i++) {
+        const sequence_t *sequence = &finding->sequence;
+        if (!sequence->events[i].pressed) {
+            continue;
+        }
+        uint16_t release = i + 1;
+        while (release < sequence->count &&
+               (sequence->events[release].pressed || sequence->events[release].row != sequence->events[i].row ||
+                sequence->events[release].col != sequence->events[i].col)) {
+            release++;
+        }
+        sequence_t candidate = {.number = sequence->number};
+        for (uint16_t j = 0; j < sequence->count; j++) {
+            if (j != i && j != release) {
+                candidate.events[candidate.count++] = sequence->events[j];
+            }
+        }
+        outcome_t outcome;
+        run(&candidate, &outcome);
+        if (same_ending(&outcome, &finding->outcome)) {
+            finding->sequence = candidate;
+            finding->outcome  = outcome;
+            i                 = -1; // start over, an earlier press may be droppable now
+        }
+    }
+}
+
+/* output */
+
+static void print_sequence(const sequence_t *sequence, int32_t marked, const char *mark) {
+    // shrinking can drop the first presses, the trace still starts at 0
+    uint32_t start = sequence->count ? sequence->events[0].time : 0;
+    for (uint16_t i = 0; i < sequence->count; i++) {
+        const fuzz_event_t *event = &sequence->events[i];
+        printf("%u %s %u %u%s%s\n", event->time - start, event->pressed ? "down" : "up", event->row, event->col,
+               i == marked ? "  # " : "", i == marked ? mark : "");
+    }
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--os unsure|linux|windows|macos|ios] [--default-layer n] [--runs n] [--presses n] "
+            "[--seed n]\n",
+            argv0);
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    uint32_t runs    = 10000;
+    uint32_t presses = 24;
+    uint32_t seed    = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--os") == 0 && i + 1 < argc) {
+            if (!sim_parse_os(argv[++i], &os)) {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "--default-layer") == 0 && i + 1 < argc) {
+            default_layer = atoi(argv[++i]);
+            if (default_layer < 0 || default_layer >= sim_layer_count) {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+            runs = strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--presses") == 0 && i + 1 < argc) {
+            presses = strtoul(argv[++i], NULL, 0);
+            if (presses == 0 || presses > (MAX_EVENTS - MAX_HELD) / 2) {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoul(argv[++i], NULL, 0);
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    shared = mmap(NULL, sizeof(*shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+    rng_state = seed ? seed : 1;
+    build_pool();
+
+    static finding_t worst_cost[WORST_KEPT];
+    static finding_t worst_delay;
+    static finding_t stuck[MAX_STUCK];
+    static finding_t crashes[MAX_STUCK];
+    uint8_t          worst_count = 0, stuck_count = 0, crash_count = 0;
+    uint32_t         stuck_runs = 0, crash_runs = 0, oneshot_runs = 0;
+    bool             counted    = false;
+
+    for (uint32_t number = 0; number < runs; number++) {
+        finding_t run_finding = {.sequence.number = number};
+        generate(&run_finding.sequence, presses);
+        run(&run_finding.sequence, &run_finding.outcome);
+        const outcome_t *outcome = &run_finding.outcome;
+        counted |= outcome->cost_insn >= 0;
+        oneshot_runs += outcome->status == RUN_OK && outcome->oneshot;
+
+        if (outcome->status != RUN_OK || outcome->stuck) {
+            finding_t *found = outcome->status == RUN_OK ? stuck : crashes;
+            uint8_t   *count = outcome->status == RUN_OK ? &stuck_count : &crash_count;
+            ++*(outcome->status == RUN_OK ? &stuck_runs : &crash_runs);
+            uint8_t i = 0;
+            while (i < *count && !same_ending(&found[i].outcome, outcome)) {
+                i++;
+            }
+            if (i < *count) {
+                found[i].hits++;
+            } else if (*count < MAX_STUCK) {
+                found[(*count)++] = (finding_t){run_finding.sequence, *outcome, 1};
+            }
+            if (outcome->status != RUN_OK) {
+                continue;
+            }
+        }
+        if (outcome->delay > worst_delay.outcome.delay || !worst_delay.sequence.count) {
+            worst_delay = run_finding;
+        }
+        // keeps the most expensive few, the cheapest of them is replaced
+        uint8_t cheapest = 0;
+        for (uint8_t i = 1; i < worst_count; i++) {
+            if (cost_of(&worst_cost[i].outcome) < cost_of(&worst_cost[cheapest].outcome)) {
+                cheapest = i;
+            }
+        }
+        if (worst_count < WORST_KEPT) {
+            worst_cost[worst_count++] = run_finding;
+        } else if (cost_of(outcome) > cost_of(&worst_cost[cheapest].outcome)) {
+            worst_cost[cheapest] = run_finding;
+        }
+    }
+
+    // a single slow event can be the host scheduling something else, the cheapest of a few runs cannot
+    finding_t *worst = NULL;
+    for (uint8_t i = 0; i < worst_count; i++) {
+        for (uint8_t repeat = 0; repeat < COST_REPEATS; repeat++) {
+            outcome_t outcome;
+            run(&worst_cost[i].sequence, &outcome);
+            if (outcome.cost_ns < worst_cost[i].outcome.cost_ns) {
+                worst_cost[i].outcome.cost_ns = outcome.cost_ns;
+            }
+        }
+        if (!worst || cost_of(&worst_cost[i].outcome) > cost_of(&worst->outcome)) {
+            worst = &worst_cost[i];
+        }
+    }
+
+    printf("# keymap %s: TAPPING_TERM %d, COMBO_TERM %d\n", SIM_KEYMAP_NAME, TAPPING_TERM, COMBO_TERM);
+    printf("# runs %u of %u presses, seed %u\n", runs, presses, seed);
+    if (worst) {
+        printf("\n# most expensive event: %luns", (unsigned long)worst->outcome.cost_ns);
+        if (counted) {
+            printf(", %ld instructions", (long)worst->outcome.cost_insn);
+        }
+        printf(", sequence %u\n", worst->sequence.number);
+        print_sequence(&worst->sequence, worst->outcome.cost_event, "most expensive");
+        printf("\n# longest dispatch delay: %ums, sequence %u\n", worst_delay.outcome.delay,
+               worst_delay.sequence.number);
+        print_sequence(&worst_delay.sequence, worst_delay.outcome.delay_event, "longest delay");
+    }
+
+    printf("\n# stuck after release of all keys: %u runs, %u distinct\n", stuck_runs, stuck_count);
+    for (uint8_t i = 0; i < stuck_count; i++) {
+        shrink(&stuck[i]);
+        printf("# %u runs, sequence %u shrunk to %u events, ", stuck[i].hits, stuck[i].sequence.number,
+               stuck[i].sequence.count);
+        sim_print_report(&stuck[i].outcome.final);
+        print_sequence(&stuck[i].sequence, -1, NULL);
+    }
+    if (oneshot_runs) {
+        printf("\n# one shot mods still armed at the end: %u runs\n", oneshot_runs);
+    }
+    printf("\n# crashed or hung: %u runs, %u distinct\n", crash_runs, crash_count);
+    for (uint8_t i = 0; i < crash_count; i++) {
+        shrink(&crashes[i]);
+        printf("# %u runs, sequence %u shrunk to %u events, %s (%s)\n", crashes[i].hits, crashes[i].sequence.number,
+               crashes[i].sequence.count, crashes[i].outcome.status == RUN_HUNG ? "hung" : "crashed",
+               strsignal(crashes[i].outcome.signal));
+        print_sequence(&crashes[i].sequence, -1, NULL);
+    }
+    return stuck_count || crash_count ? 1 : 0;
+}
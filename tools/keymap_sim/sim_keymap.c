@@ -0,0 +1,20 @@
+// Compiles the keymap under test into the simulator, the same way QMK's keymap introspection pulls it in.
+#include KEYMAP_C
+
+#include "sim.h"
+
+const uint16_t (*const sim_keymaps)[MATRIX_ROWS][MATRIX_COLS] = keymaps;
+const uint8_t  sim_layer_count                                 = ARRAY_SIZE(keymaps);
+combo_t *const sim_combos                                      = key_combos;
+const uint16_t sim_combo_count                                 = ARRAY_SIZE(key_combos);
+
+uint8_t keymap_layer_count(void) {
+    return ARRAY_SIZE(keymaps);
+}
+
+uint16_t combo_count(void) {
+    return ARRAY_SIZE(key_combos);
+}
+combo_t *combo_get(uint16_t combo_idx) {
+    return &key_combos[combo_idx];
+}
@@ -0,0 +1,324 @@
+// Replays a recorded key trace through a keymap and prints the resulting HID reports with per-event latency.
+//
+// Trace lines are "<ms> <down|up> <row> <col>", '#' starts a comment. See README.md for the matrix layout.
+#include <errno.h>
+#include <stdlib.h>
+
+#include "sim.h"
+
+typedef struct {
+    uint32_t time;
+    uint32_t dispatched; // UINT32_MAX until the event reaches process_record
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+    uint64_t cost_ns;
+    int64_t  insn;
+} trace_event_t;
+
+typedef enum {
+    LOG_DISPATCH,
+    LOG_REPORT,
+    LOG_EXTRA,
+} log_kind_t;
+
+typedef struct {
+    log_kind_t kind;
+    uint32_t   index;
+} log_entry_t;
+
+typedef struct {
+    uint32_t time;
+    uint16_t keycode;
+    bool     pressed;
+} extra_t;
+
+#define VEC(type)      \
+    struct {           \
+        type  *items;  \
+        size_t count;  \
+        size_t cap;    \
+    }
+
+#define VEC_PUSH(vec, item)                                                         \
+    do {                                                                            \
+        if ((vec).count == (vec).cap) {                                             \
+            (vec).cap   = (vec).cap ? (vec).cap * 2 : 256;                          \
+            (vec).items = realloc((vec).items, (vec).cap * sizeof(*(vec).items));   \
+            if (!(vec).items) {                                                     \
+                perror("realloc");                                                  \
+                exit(1);                                                            \
+            }                                                                       \
+        }                                                                           \
+        (vec).items[(vec).count++] = (item);                                        \
+    } while (0)
+
+static VEC(trace_event_t) events;
+static VEC(sim_report_t) reports;
+static VEC(extra_t) extras;
+static VEC(log_entry_t) log_entries;
+
+static bool show_cost = true;
+static bool quiet     = false;
+
+static void on_report(const sim_report_t *report) {
+    VEC_PUSH(reports, *report);
+    VEC_PUSH(log_entries, ((log_entry_t){LOG_REPORT, reports.count - 1}));
+}
+
+static void on_extra(uint32_t time, uint16_t keycode, bool pressed) {
+    VEC_PUSH(extras, ((extra_t){time, keycode, pressed}));
+    VEC_PUSH(log_entries, ((log_entry_t){LOG_EXTRA, extras.count - 1}));
+}
+
+static void on_dispatch(uint32_t event_id, uint32_t time) {
+    if (event_id >= events.count || events.items[event_id].dispatched != UINT32_MAX) {
+        return; // combos dispatch a second record for the same input
+    }
+    events.items[event_id].dispatched = time;
+    VEC_PUSH(log_entries, ((log_entry_t){LOG_DISPATCH, event_id}));
+}
+
+static void print_event(const trace_event_t *event) {
+    printf("%8u key    %-4s r%uc%u in=%u delay=%ums", event->dispatched, event->pressed ? "down" : "up", event->row,
+           event->col, event->time, event->dispatched - event->time);
+    if (show_cost) {
+        printf(" cost=%luns", (unsigned long)event->cost_ns);
+        if (event->insn >= 0) {
+            printf(" insn=%ld", (long)event->insn);
+        }
+    }
+    printf("\n");
+}
+
+static int compare_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void print_percentiles(const char *label, uint64_t *values, size_t count, const char *unit) {
+    if (count == 0) {
+        return;
+    }
+    uint64_t sum = 0;
+    qsort(values, count, sizeof(*values), compare_u64);
+    for (size_t i = 0; i < count; i++) {
+        sum += values[i];
+    }
+    printf("# %-28s p50 %lu%s  p95 %lu%s  p99 %lu%s  max %lu%s  mean %.1f%s\n", label,
+           (unsigned long)values[count / 2], unit, (unsigned long)values[count * 95 / 100], unit,
+           (unsigned long)values[count * 99 / 100], unit, (unsigned long)values[count - 1], unit, (double)sum / count,
+           unit);
+}
+
+static void print_cost(const char *label, const sim_cost_t *cost) {
+    if (cost->calls == 0) {
+        return;
+    }
+    printf("# %-28s calls %u  mean %.0fns  max %luns\n", label, cost->calls, (double)cost->ns / cost->calls,
+           (unsigned long)cost->max_ns);
+}
+
+static void print_summary(void) {
+    uint64_t *values     = malloc((events.count ? events.count : 1) * sizeof(uint64_t));
+    size_t    count      = 0;
+    size_t    undelivered = 0;
+
+    printf("# keymap %s: TAPPING_TERM %d, COMBO_TERM %d\n", SIM_KEYMAP_NAME, TAPPING_TERM, COMBO_TERM);
+    printf("# events %zu, reports %zu\n", events.count, reports.count);
+
+    for (size_t i = 0; i < events.count; i++) {
+        if (events.items[i].dispatched == UINT32_MAX) {
+            undelivered++;
+        } else {
+            values[count++] = events.items[i].dispatched - events.items[i].time;
+        }
+    }
+    print_percentiles("dispatch delay", values, count, "ms");
+    if (undelivered) {
+        printf("# undelivered events %zu\n", undelivered);
+    }
+
+    if (show_cost) {
+        for (size_t i = 0; i < events.count; i++) {
+            values[i] = events.items[i].cost_ns;
+        }
+        print_percentiles("event cost", values, events.count, "ns");
+        if (sim_insn_available()) {
+            for (size_t i = 0; i < events.count; i++) {
+                values[i] = events.items[i].insn < 0 ? 0 : (uint64_t)events.items[i].insn;
+            }
+            print_percentiles("event instructions", values, events.count, "");
+        }
+        print_cost("process_record_user", &sim_stats.process_record_user);
+        print_cost("oled_task_user", &sim_stats.oled_task_user);
+        print_cost("rgb_matrix_indicators", &sim_stats.rgb_matrix_indicators);
+        print_cost("rgb_matrix frame", &sim_stats.rgb_matrix_frame);
+        print_cost("scan/housekeeping hooks", &sim_stats.housekeeping);
+    }
+
+    if (sim_stats.eeprom_writes) {
+        printf("# eeprom user data writes %u, bytes changed %u\n", sim_stats.eeprom_writes, sim_stats.eeprom_bytes);
+    }
+    if (sim_stats.oled_blocks) {
+        printf("# oled bytes changed %u, blocks sent %u (%u bytes), at most %u blocks in one update\n",
+               sim_stats.oled_bytes, sim_stats.oled_blocks, sim_stats.oled_blocks * (OLED_MATRIX_SIZE / 16),
+               sim_stats.oled_max_blocks);
+    }
+    if (sim_stats.split_rpcs) {
+        printf("# split transactions %u, bytes %u\n", sim_stats.split_rpcs, sim_stats.split_bytes);
+    }
+
+    sim_report_t final;
+    sim_current_report(&final);
+    bool stuck = final.mods != 0;
+    for (uint8_t i = 0; i < SIM_NKRO_BYTES; i++) {
+        stuck |= final.keys[i] != 0;
+    }
+    if (stuck) {
+        printf("# stuck after release of all keys: ");
+        sim_print_report(&final);
+    } else {
+        printf("# stuck: none\n");
+    }
+    free(values);
+}
+
+static void load_trace(FILE *file, const char *path) {
+    char     line[256];
+    uint32_t line_number = 0;
+    uint32_t last_time   = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+        unsigned long time;
+        char          direction[8];
+        unsigned int  row, col;
+
+        line_number++;
+        char *comment = strchr(line, '#');
+        if (comment) {
+            *comment = '\0';
+        }
+        if (strspn(line, " \t\r\n") == strlen(line)) {
+            continue;
+        }
+        if (sscanf(line, "%lu %7s %u %u", &time, direction, &row, &col) != 4 || row >= MATRIX_ROWS ||
+            col >= MATRIX_COLS || time < last_time) {
+            fprintf(stderr, "%s:%u: expected \"<ms> <down|up> <row> <col>\" in time order\n", path, line_number);
+            exit(2);
+        }
+        trace_event_t event = {
+            .time       = time,
+            .dispatched = UINT32_MAX,
+            .row        = row,
+            .col        = col,
+            .pressed    = direction[0] == 'd',
+            .insn       = -1,
+        };
+        if (direction[0] != 'd' && direction[0] != 'u') {
+            fprintf(stderr, "%s:%u: direction must be down or up\n", path, line_number);
+            exit(2);
+        }
+        last_time = time;
+        VEC_PUSH(events, event);
+    }
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--os unsure|linux|windows|macos|ios] [--default-layer n] [--slave] [--no-cost] [--quiet] "
+            "[trace]\n",
+            argv0);
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    os_variant_t os            = OS_UNSURE;
+    int          default_layer = -1;
+    const char  *path          = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--os") == 0 && i + 1 < argc) {
+            if (!sim_parse_os(argv[++i], &os)) {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "--default-layer") == 0 && i + 1 < argc) {
+            default_layer = atoi(argv[++i]);
+            if (default_layer < 0 || default_layer >= sim_layer_count) {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "--slave") == 0) {
+            sim_master = false;
+        } else if (strcmp(argv[i], "--no-cost") == 0) {
+            show_cost = false;
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            quiet = true;
+        } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+            usage(argv[0]);
+        } else if (!path) {
+            path = argv[i];
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    FILE *file = stdin;
+    if (path && strcmp(path, "-") != 0) {
+        file = fopen(path, "r");
+        if (!file) {
+            fprintf(stderr, "%s: %s\n", path, strerror(errno));
+            return 2;
+        }
+    }
+    load_trace(file, path ? path : "-");
+    if (file != stdin) {
+        fclose(file);
+    }
+
+    if (show_cost) {
+        sim_insn_open();
+    }
+    sim_callbacks_t callbacks = {.report = on_report, .extra = on_extra, .dispatch = on_dispatch};
+    sim_init(&callbacks, os);
+    if (default_layer >= 0) {
+        // as if it had been picked with PDF() before the trace
+        default_layer_set((layer_state_t)1 << default_layer);
+    }
+
+    for (uint32_t i = 0; i < events.count; i++) {
+        trace_event_t *event = &events.items[i];
+        sim_run_until(event->time);
+        uint64_t start = sim_clock_ns();
+        sim_insn_start();
+        sim_key_event(i, event->time, (keypos_t){.row = event->row, .col = event->col}, event->pressed);
+        event->insn    = sim_insn_stop();
+        event->cost_ns = sim_clock_ns() - start;
+    }
+    // let pending tap-hold and combo decisions time out
+    uint32_t settle = sim_now() + 1;
+    while (!sim_is_settled() || sim_now() < settle) {
+        sim_run_until(sim_now() + 1);
+    }
+    sim_run_until(sim_now() + (TAPPING_TERM > COMBO_TERM ? TAPPING_TERM : COMBO_TERM));
+
+    if (!quiet) {
+        for (size_t i = 0; i < log_entries.count; i++) {
+            switch (log_entries.items[i].kind) {
+                case LOG_DISPATCH:
+                    print_event(&events.items[log_entries.items[i].index]);
+                    break;
+                case LOG_REPORT:
+                    sim_print_report(&reports.items[log_entries.items[i].index]);
+                    break;
+                case LOG_EXTRA: {
+                    const extra_t *extra = &extras.items[log_entries.items[i].index];
+                    printf("%8u extra  %c0x%04X\n", extra->time, extra->pressed ? '+' : '-', extra->keycode);
+                    break;
+                }
+            }
+        }
+    }
+    print_summary();
+    return 0;
+}
@@ -0,0 +1,43 @@
+// Runs the keymap's own rgb matrix effects the way upstream rgb_matrix.c does, with stand-ins for the built in
+// effects the keymaps enable, so the cost of a whole frame can be compared between them.
+#include "sim.h"
+
+#ifdef RGB_MATRIX_CUSTOM_USER
+#    define RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#    define RGB_MATRIX_EFFECT(name, ...)
+#    include "rgb_matrix_user.inc"
+#    undef RGB_MATRIX_EFFECT
+#    undef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#endif
+
+// SOLID_COLOR and BREATHING draw one colour for every led of the chunk, breathing with a triangle instead of sin8
+static bool sim_solid_color(effect_params_t *params, uint8_t scale) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    hsv_t hsv = rgb_matrix_get_hsv();
+    hsv.v     = scale8(hsv.v, scale);
+    rgb_t rgb = hsv_to_rgb(hsv);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+bool sim_rgb_effect(effect_params_t *params) {
+    switch (rgb_matrix_get_mode()) {
+        case RGB_MATRIX_SOLID_COLOR:
+            return sim_solid_color(params, 255);
+        case RGB_MATRIX_BREATHING: {
+            uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_get_speed() / 8);
+            return sim_solid_color(params, time < 128 ? time * 2 : (255 - time) * 2);
+        }
+#ifdef RGB_MATRIX_CUSTOM_USER
+#    define RGB_MATRIX_EFFECT(name, ...)   \
+        case RGB_MATRIX_CUSTOM_##name: \
+            return name(params);
+#    include "rgb_matrix_user.inc"
+#    undef RGB_MATRIX_EFFECT
+#endif
+        default:
+            return false;
+    }
+}
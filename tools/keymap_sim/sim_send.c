@@ -0,0 +1,98 @@
+// Sends the strings of bench_strings.h with SEND_STRING and as packed nkro reports, and compares how many reports each
+// takes and whether a host types the string back from them. A full speed USB keyboard sends one report per 1ms poll,
+// so the reports are also about the milliseconds a macro takes.
+#include <stdlib.h>
+
+#include "sim.h"
+#include "nkro_send.h"
+#include "bench_strings.h"
+#include "bench_strings_nkro.h"
+
+#define TYPED_MAX 256
+
+typedef struct {
+    const char    *name;
+    const char    *text;
+    const uint8_t *packed;
+    uint32_t       check;
+} bench_t;
+
+static const bench_t benches[] = {
+    {"otp", BENCH_OTP, (const uint8_t[])BENCH_OTP_NKRO, BENCH_OTP_NKRO_CHECK},
+    {"sentence", BENCH_SENTENCE, (const uint8_t[])BENCH_SENTENCE_NKRO, BENCH_SENTENCE_NKRO_CHECK},
+    {"password", BENCH_PASSWORD, (const uint8_t[])BENCH_PASSWORD_NKRO, BENCH_PASSWORD_NKRO_CHECK},
+    {"command", BENCH_COMMAND, (const uint8_t[])BENCH_COMMAND_NKRO, BENCH_COMMAND_NKRO_CHECK},
+};
+
+static uint32_t reports;
+static char     typed[TYPED_MAX];
+static uint16_t typed_count;
+static uint8_t  down[SIM_NKRO_BYTES];
+
+static char host_char(uint8_t keycode, bool shift) {
+    for (int c = 1; c < 128; c++) {
+        uint16_t key = sim_ascii_to_keycode(c);
+        if ((key & 0xFF) == keycode && (bool)(QK_MODS_GET_MODS(key) & MOD_LSFT) == shift) {
+            return c;
+        }
+    }
+    return '?';
+}
+
+// what a host does with a report: every key that was not down yet is typed, in keycode order, with the report's shift
+static void on_report(const sim_report_t *report) {
+    bool shift = report->mods & MOD_MASK_SHIFT;
+    reports++;
+    for (uint16_t keycode = 0; keycode < SIM_NKRO_BYTES * 8; keycode++) {
+        bool pressed = report->keys[keycode / 8] & (1 << (keycode % 8));
+        bool was     = down[keycode / 8] & (1 << (keycode % 8));
+        if (pressed && !was && typed_count < TYPED_MAX - 1) {
+            typed[typed_count++] = host_char(keycode, shift);
+        }
+    }
+    memcpy(down, report->keys, sizeof(down));
+}
+
+static uint32_t run(const bench_t *bench, bool packed, bool nkro) {
+    clear_keyboard();
+    reports     = 0;
+    typed_count = 0;
+    memset(down, 0, sizeof(down));
+    sim_nkro = nkro;
+    if (packed) {
+        nkro_send_packed(bench->packed);
+    } else {
+        send_string(bench->text);
+    }
+    typed[typed_count] = '\0';
+    return reports;
+}
+
+static void print_run(const bench_t *bench, const char *sender, uint32_t count, uint32_t baseline) {
+    bool ok = strcmp(typed, bench->text) == 0;
+    printf("%-10s %5zu  %-12s %7u %6.2f  %5.1fx  %s\n", bench->name, strlen(bench->text), sender, count,
+           (double)count / strlen(bench->text), (double)baseline / count, ok ? "ok" : "WRONG");
+}
+
+int main(int argc, char **argv) {
+    sim_callbacks_t callbacks = {.report = on_report};
+    bool            failed    = false;
+    sim_init(&callbacks, OS_LINUX);
+    printf("# keymap %s, reports at one per 1ms usb poll\n", SIM_KEYMAP_NAME);
+    printf("%-10s %5s  %-12s %7s %6s  %6s  %s\n", "string", "chars", "sender", "reports", "/char", "faster", "typed");
+    for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+        const bench_t *bench    = &benches[i];
+        if (nkro_string_check(bench->text) != bench->check) {
+            printf("%-10s NAME_NKRO_CHECK does not match the string\n", bench->name);
+            failed = true;
+        }
+        uint32_t       baseline = run(bench, false, true);
+        print_run(bench, "SEND_STRING", baseline, baseline);
+        failed |= strcmp(typed, bench->text) != 0;
+        print_run(bench, "nkro", run(bench, true, true), baseline);
+        failed |= strcmp(typed, bench->text) != 0;
+        print_run(bench, "nkro as 6kro", run(bench, true, false), baseline);
+        failed |= strcmp(typed, bench->text) != 0;
+    }
+    return failed;
+}
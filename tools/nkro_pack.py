@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Pack string macros into the keyboard reports nkro_send_packed plays.
+
+    tools/nkro_pack.py --out keymaps/jari27/nkro_strings.h keymaps/jari27/*.h YUBIKEY_CODE
+
+Every NAME that one of the headers defines as a string gets a NAME_NKRO initializer in the output, the names that are
+not defined are left out so the keymap falls back to SEND_STRING. The output has the strings in it, so it lives next
+to secrets.h and is git ignored like it.
+
+SEND_STRING sends a press and a release report per character, and two more around every shifted one. The host reads
+all keys of one NKRO report in the order of their keycodes, so as long as the keycodes go up, a single report can
+type many characters. A report ends where the next keycode is not higher than the last one, which includes a
+repeated character, and where shift changes. A release report is added in between when shift changes or when the
+next report presses a key that is still down. Packed reports are checked by typing them back the way a host would, and
+NAME_NKRO_CHECK, the FNV-1a hash of the string, lets the keymap check that the header is not older than the string.
+
+    <reports, 2 bytes little endian> then per report <shift << 7 | key count> <keycodes, ascending>
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SHIFT = 0x80
+MAX_KEYS = 0x7F
+
+# keycodes of the US layout QMK's SEND_STRING uses, see keymap_us.h and send_string_keycodes.h
+KC_A, KC_1, KC_0 = 0x04, 0x1E, 0x27
+UNSHIFTED = {'\n': 0x28, '\t': 0x2B, ' ': 0x2C, '-': 0x2D, '=': 0x2E, '[': 0x2F, ']': 0x30, '\\': 0x31, ';': 0x33,
+             '\'': 0x34, '`': 0x35, ',': 0x36, '.': 0x37, '/': 0x38}
+SHIFTED = {'!': 0x1E, '@': 0x1F, '#': 0x20, '$': 0x21, '%': 0x22, '^': 0x23, '&': 0x24, '*': 0x25, '(': 0x26, ')': 0x27,
+           '_': 0x2D, '+': 0x2E, '{': 0x2F, '}': 0x30, '|': 0x31, ':': 0x33, '"': 0x34, '~': 0x35, '<': 0x36, '>': 0x37,
+           '?': 0x38}
+KEYS = {c: (code, False) for c, code in UNSHIFTED.items()}
+KEYS.update({c: (code, True) for c, code in SHIFTED.items()})
+for i in range(26):
+    KEYS[chr(ord('a') + i)] = (KC_A + i, False)
+    KEYS[chr(ord('A') + i)] = (KC_A + i, True)
+for i in range(9):
+    KEYS[chr(ord('1') + i)] = (KC_1 + i, False)
+KEYS['0'] = (KC_0, False)
+TYPED = {key: c for c, key in KEYS.items()}
+
+STRING_DEFINE = re.compile(r'^\s*#\s*define\s+(\w+)\s+((?:"(?:[^"\\\n]|\\.)*"[ \t]*)+)(?://.*)?$', re.M)
+ESCAPES = {'n': '\n', 't': '\t', '\\': '\\', '\'': '\'', '"': '"'}
+
+
+def unescape(literals):
+    text = ''.join(re.findall(r'"((?:[^"\\\n]|\\.)*)"', literals))
+    return re.sub(r'\\(x[0-9a-fA-F]{1,2}|.)',
+                  lambda m: chr(int(m.group(1)[1:], 16)) if m.group(1)[0] == 'x' else ESCAPES.get(m.group(1), m.group(1)),
+                  text)
+
+
+def pack(text):
+    """The reports for text as (shift, keycodes) tuples."""
+    chunks = []
+    for c in text:
+        if c not in KEYS:
+            raise ValueError('%r is not on the US layout SEND_STRING types' % c)
+        code, shift = KEYS[c]
+        last = chunks[-1] if chunks else None
+        if last and last[0] == shift and code > last[1][-1] and len(last[1]) < MAX_KEYS:
+            last[1].append(code)
+        else:
+            chunks.append((shift, [code]))
+    reports, down, down_shift = [], set(), False
+    for shift, codes in chunks:
+        if down and (shift != down_shift or down & set(codes)):
+            reports.append((shift, []))
+        reports.append((shift, codes))
+        down, down_shift = set(codes), shift
+    reports.append((False, []))
+    return reports
+
+
+def typed(reports):
+    """What a host types from the reports: new keys of a report in keycode order, with the report's shift."""
+    out, down = '', set()
+    for shift, codes in reports:
+        out += ''.join(TYPED[(code, shift)] for code in sorted(set(codes) - down))
+        down = set(codes)
+    return out
+
+
+def check(text):
+    """FNV-1a of the string, what nkro_string_check in nkro_send.c computes."""
+    value = 0x811C9DC5
+    for c in text.encode('latin-1'):
+        value = ((value ^ c) * 0x01000193) & 0xFFFFFFFF
+    return value
+
+
+def encode(reports):
+    data = [len(reports) & 0xFF, len(reports) >> 8]
+    for shift, codes in reports:
+        data += [(SHIFT if shift else 0) | len(codes)] + codes
+    return data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--out', required=True, help='header to write, only rewritten when it changed')
+    parser.add_argument('inputs', nargs='+', help='headers to read the strings from, then the names to pack')
+    args = parser.parse_args()
+
+    headers = [path for path in args.inputs if os.path.isfile(path)]
+    names = [name for name in args.inputs if name not in headers and re.fullmatch(r'\w+', name)]
+    strings = {}
+    for path in headers:
+        with open(path) as f:
+            for name, literals in STRING_DEFINE.findall(f.read()):
+                if name in names:
+                    strings[name] = (unescape(literals), os.path.basename(path))
+
+    out = ('#pragma once\n\n'
+           '// generated by tools/nkro_pack.py, do not edit. it has the strings of the macros in it, do not commit it\n')
+    for name in names:
+        if name not in strings:
+            continue
+        text, source = strings[name]
+        try:
+            reports = pack(text)
+            if typed(reports) != text:
+                raise ValueError('the reports do not type the string back')
+        except ValueError as error:
+            # without the header the keymap sends the string with SEND_STRING instead of an old packed one
+            if os.path.exists(args.out):
+                os.remove(args.out)
+            sys.exit('%s in %s: %s' % (name, source, error))
+        data = encode(reports)
+        out += ('\n// %s from %s: %d characters in %d reports, SEND_STRING sends %d\n'
+                '#define %s_NKRO {%s}\n#define %s_NKRO_CHECK 0x%08x\n'
+                % (name, source, len(text), len(reports), sum(4 if KEYS[c][1] else 2 for c in text), name,
+                   ', '.join('0x%02x' % b for b in data), name, check(text)))
+
+    current = open(args.out).read() if os.path.exists(args.out) else None
+    if current != out:
+        with open(args.out, 'w') as f:
+            f.write(out)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Report flash and RAM use of the firmware built from qmk.json, and what changed since a saved baseline.
+
+    qmk userspace-compile && tools/size_report.py
+    tools/size_report.py --compile --save     # build every target and keep the result as the new baseline
+
+Flash is text + data and RAM is data + bss, as reported by arm-none-eabi-size for every jari27 .elf in the QMK build
+directory. The baseline is tools/size_baseline.json, which is not checked in because it depends on the QMK version.
+"""
+
+import argparse
+import glob
+import json
+import os
+import subprocess
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_BASELINE = os.path.join(HERE, 'size_baseline.json')
+
+
+def qmk_home():
+    """Where qmk_firmware is, the same way the Makefile finds it."""
+    if os.environ.get('QMK_HOME'):
+        return os.environ['QMK_HOME']
+    try:
+        output = subprocess.run(['qmk', 'config', '-ro', 'user.qmk_home'], capture_output=True, text=True).stdout
+    except FileNotFoundError:
+        output = ''
+    home = output.strip().partition('=')[2]
+    return home if home and home != 'None' else os.path.expanduser('~/qmk_firmware')
+
+
+def elf_sizes(size_tool, paths):
+    """{target: {'flash': bytes, 'ram': bytes}} from the berkeley output of size."""
+    output = subprocess.run([size_tool, '-B'] + paths, check=True, capture_output=True, text=True).stdout
+    sizes = {}
+    for line in output.splitlines()[1:]:
+        text, data, bss, _, _, path = line.split(None, 5)
+        target = os.path.splitext(os.path.basename(path))[0]
+        sizes[target] = {'flash': int(text) + int(data), 'ram': int(data) + int(bss)}
+    return sizes
+
+
+def delta(now, before):
+    if before is None:
+        return ''
+    change = now - before
+    return '%+7d' % change if change else '      ='
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--build-dir', help='where qmk puts the .elf files, .build in qmk_firmware by default')
+    parser.add_argument('--baseline', default=DEFAULT_BASELINE, help='sizes to compare against')
+    parser.add_argument('--size', default='arm-none-eabi-size', help='size tool of the toolchain')
+    parser.add_argument('--compile', action='store_true', help='run qmk userspace-compile first')
+    parser.add_argument('--save', action='store_true', help='store the sizes as the new baseline')
+    args = parser.parse_args()
+
+    if args.compile:
+        subprocess.run(['qmk', 'userspace-compile'], check=True, cwd=os.path.dirname(HERE))
+    build_dir = args.build_dir or os.path.join(qmk_home(), '.build')
+    paths = sorted(glob.glob(os.path.join(build_dir, '*jari27*.elf')))
+    if not paths:
+        sys.exit('no jari27 .elf files in %s, build with qmk userspace-compile first' % build_dir)
+
+    sizes = elf_sizes(args.size, paths)
+    baseline = {}
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+
+    print('%-60s %8s %7s %8s %7s' % ('target', 'flash', '', 'ram', ''))
+    for target, size in sorted(sizes.items()):
+        before = baseline.get(target, {})
+        print('%-60s %8d %s %8d %s' % (target, size['flash'], delta(size['flash'], before.get('flash')), size['ram'],
+                                       delta(size['ram'], before.get('ram'))))
+
+    if args.save:
+        baseline.update(sizes)
+        with open(args.baseline, 'w') as f:
+            json.dump(baseline, f, indent=4, sort_keys=True)
+            f.write('\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""Pack the OLED art in users/jari27/art into the sprites of users/jari27/oled_art.c.
+
+    tools/sprite_pack.py            # rewrite users/jari27/oled_art.c and .h when an image changed
+    tools/sprite_pack.py --check    # exit 1 if they are out of date
+
+The images are plain pbm (P1) files, one character per pixel, 1 is lit. They are drawn as the screen is read, 32
+pixels wide on the rotated lily58 oled, and their height has to be a multiple of the 8 pixel lines. GIMP and most
+other editors open and save them, a text editor works as well.
+
+A sprite is 4 header bytes, then the pixels as runs. The header is the left edge in pixels and the top in lines of
+the part of the image that is not blank, then its width in pixels and height in lines. Only that box is drawn, the
+blank rows and columns around it are not stored. The pixels are read column by column, top to bottom, and every run
+of unlit or lit pixels is a nibble, high nibble first. Runs alternate between unlit and lit, starting with unlit. A
+nibble of 15 is 15 pixels and the run goes on in the next nibble, so a run of 15 is followed by a 0. See
+oled_sprite.c for the decoder.
+
+A directory with the name of an image holds the frames that follow it, 01.pbm, 02.pbm and so on, and makes it an
+animation. The image itself is the first frame and is drawn as a sprite, every other frame only as the bytes that
+changed since the one before, and the last frame also has the changes back to the first. A frame's changes are a
+count of spans and then for every span its line, x and length and that many buffer bytes, one column of 8 pixels
+each. Spans never cross a line and close changes share a span when that is smaller. See oled_anim.c for the player.
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+USER = os.path.join(ROOT, 'users', 'jari27')
+ART = os.path.join(USER, 'art')
+OUT_C = os.path.join(USER, 'oled_art.c')
+OUT_H = os.path.join(USER, 'oled_art.h')
+
+CONTINUE = 15
+SPAN_HEADER = 3  # line, x, length
+
+
+def read_pbm(path):
+    """(width, height, rows of 0 and 1) of an ascii pbm."""
+    with open(path) as f:
+        tokens = re.sub(r'#[^\n]*', ' ', f.read()).split()
+    if not tokens or tokens[0] != 'P1':
+        sys.exit('%s: not an ascii pbm (P1)' % path)
+    width, height = int(tokens[1]), int(tokens[2])
+    pixels = [int(c) for c in ''.join(tokens[3:]) if c in '01']
+    if len(pixels) != width * height:
+        sys.exit('%s: %d pixels instead of %dx%d' % (path, len(pixels), width, height))
+    if height % 8:
+        sys.exit('%s: height %d is not a multiple of 8' % (path, height))
+    return width, height, [pixels[y * width:(y + 1) * width] for y in range(height)]
+
+
+def bounding_box(width, height, rows):
+    """(left, top line, width, lines) of the part that is not blank, at least one pixel."""
+    columns = [x for x in range(width) if any(row[x] for row in rows)] or [0]
+    lines = [y // 8 for y in range(height) if any(rows[y])] or [0]
+    return columns[0], lines[0], columns[-1] + 1 - columns[0], lines[-1] + 1 - lines[0]
+
+
+def encode(rows, box):
+    left, top, width, lines = box
+    pixels = [rows[y][x] for x in range(left, left + width) for y in range(top * 8, (top + lines) * 8)]
+    nibbles, colour, run = [], 0, 0
+    for pixel in pixels + [None]:
+        if pixel == colour:
+            run += 1
+            continue
+        while run >= CONTINUE:
+            nibbles.append(CONTINUE)
+            run -= CONTINUE
+        nibbles.append(run)
+        colour, run = pixel, 1
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return list(box) + [nibbles[i] << 4 | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def decode(sprite):
+    """The box and pixels back, the way oled_sprite_draw reads them."""
+    left, top, width, lines = sprite[:4]
+    nibbles = [n for byte in sprite[4:] for n in (byte >> 4, byte & 0x0F)]
+    pixels, colour, toggle = [], 0, False
+    for nibble in nibbles:
+        if toggle:
+            colour ^= 1
+        pixels += [colour] * nibble
+        toggle = nibble != CONTINUE
+    return (left, top, width, lines), pixels[:width * lines * 8]
+
+
+def buffer_bytes(width, height, rows):
+    """The image as the oled buffer has it, a list of lines of column bytes with the top pixel in bit 0."""
+    return [[sum(rows[line * 8 + bit][x] << bit for bit in range(8)) for x in range(width)] for line in range(height // 8)]
+
+
+def delta(before, after):
+    """The spans that turn one frame into the next, as bytes, and the lines they touch."""
+    spans = []
+    for line, (old, new) in enumerate(zip(before, after)):
+        changed = [x for x in range(len(new)) if old[x] != new[x]]
+        for x in changed:
+            # a gap shorter than a span header is cheaper to write again than to skip
+            if spans and spans[-1][0] == line and x - spans[-1][2] <= SPAN_HEADER:
+                spans[-1][2] = x + 1
+            else:
+                spans.append([line, x, x + 1])
+    if len(spans) > 255:
+        sys.exit('%d spans in one frame, at most 255' % len(spans))
+    out = [len(spans)]
+    for line, start, end in spans:
+        out += [line, start, end - start] + after[line][start:end]
+    return out, len({span[0] for span in spans}), sum(end - start for _, start, end in spans)
+
+
+def apply(frame, changes):
+    """A frame with the changes of delta written over it, the way oled_anim_task writes them."""
+    frame, i = [line[:] for line in frame], 1
+    for _ in range(changes[0]):
+        line, x, length = changes[i:i + 3]
+        frame[line][x:x + length] = changes[i + 3:i + 3 + length]
+        i += 3 + length
+    return frame
+
+
+def animation(name, frame_paths, first):
+    """C for the deltas of an animation and a description of what one frame costs at most."""
+    frames = [first] + [read_pbm(path) for path in frame_paths]
+    for path, frame in zip(frame_paths, frames[1:]):
+        if frame[:2] != first[:2]:
+            sys.exit('%s: %dx%d, the first frame is %dx%d' % ((path,) + frame[:2] + first[:2]))
+    columns = [buffer_bytes(*frame) for frame in frames]
+    data, lines, written = [], 0, 0
+    for i in range(len(columns)):
+        out, touched, count = delta(columns[i], columns[(i + 1) % len(columns)])
+        if apply(columns[i], out) != columns[(i + 1) % len(columns)]:
+            sys.exit('%s: frame %d does not follow from the one before' % (name, (i + 1) % len(columns)))
+        data += out
+        lines, written = max(lines, touched), max(written, count)
+    out_c = '\nstatic const uint8_t anim_%s_deltas[] PROGMEM = {\n' % name
+    for i in range(0, len(data), 16):
+        out_c += '    %s,\n' % ', '.join('0x%02x' % b for b in data[i:i + 16])
+    out_c += '};\n\nconst oled_anim_t anim_%s = {art_%s, anim_%s_deltas, %d};\n' % (name, name, name, len(frames))
+    out_h = ('extern const oled_anim_t anim_%s; // %d frames, %d bytes of changes, each frame at most %d bytes on %d lines\n'
+             % (name, len(frames), len(data), written, lines))
+    return out_c, out_h, len(data)
+
+
+def generate(images):
+    out_c = ('#include "oled_art.h"\n\n'
+             '// generated by tools/sprite_pack.py from users/jari27/art, do not edit\n\n'
+             '// clang-format off\n')
+    out_h = ('#pragma once\n\n'
+             '#include "oled_anim.h"\n\n'
+             '// generated by tools/sprite_pack.py from users/jari27/art, do not edit. sprites are drawn with\n'
+             '// oled_sprite_draw and animations played with oled_anim_task\n\n')
+    anims_c, anims_h = '', ''
+    stored = 0
+    for name, path in images:
+        width, height, rows = read_pbm(path)
+        box = bounding_box(width, height, rows)
+        sprite = encode(rows, box)
+        left, top, w, lines = box
+        if decode(sprite) != (box, [rows[y][x] for x in range(left, left + w) for y in range(top * 8, (top + lines) * 8)]):
+            sys.exit('%s: does not decode to the same pixels' % path)
+        raw = width * height // 8
+        stored += len(sprite)
+        out_h += 'extern const uint8_t art_%s[] PROGMEM; // %dx%d, %d bytes instead of %d\n' % (
+            name, width, height, len(sprite), raw)
+        out_c += '\nconst uint8_t art_%s[] PROGMEM = {\n    %d, %d, %d, %d,\n' % ((name,) + box)
+        data = sprite[4:]
+        for i in range(0, len(data), 16):
+            out_c += '    %s,\n' % ', '.join('0x%02x' % b for b in data[i:i + 16])
+        out_c += '};\n'
+        frame_paths = sorted(glob.glob(os.path.join(ART, name, '*.pbm')))
+        if frame_paths:
+            anim_c, anim_h, size = animation(name, frame_paths, (width, height, rows))
+            anims_c += anim_c
+            anims_h += anim_h
+            stored += size
+    if anims_h:
+        out_h += '\n' + anims_h
+    out_c += anims_c + '// clang-format on\n'
+    return out_c, out_h, stored
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--check', action='store_true', help='only report if the generated files are out of date')
+    args = parser.parse_args()
+
+    images = [(os.path.splitext(os.path.basename(path))[0], path) for path in sorted(glob.glob(os.path.join(ART, '*.pbm')))]
+    if not images:
+        sys.exit('no images in %s' % os.path.relpath(ART, ROOT))
+    out_c, out_h, stored = generate(images)
+
+    stale = []
+    for path, content in ((OUT_C, out_c), (OUT_H, out_h)):
+        current = open(path).read() if os.path.exists(path) else None
+        if current != content:
+            stale.append(path)
+            if not args.check:
+                with open(path, 'w') as f:
+                    f.write(content)
+    if args.check:
+        for path in stale:
+            print('%s is out of date, run tools/sprite_pack.py' % os.path.relpath(path, ROOT), file=sys.stderr)
+        sys.exit(1 if stale else 0)
+    print('%d images, %d bytes' % (len(images), stored))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Decode the binary event trace the keymaps write to the console (TRACE_LEVEL in rules.mk).
+
+    qmk console | tools/trace_decode.py
+    tools/trace_decode.py --keycodes users/jari27/jari27.h console.log
+
+Every record is a '#T' line with 10 bytes in hex, see trace_log.c. Other console output is passed through.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+EVENTS = {1: 'key', 2: 'report', 3: 'layer', 4: 'default', 5: 'os', 6: 'dropped'}
+OS_NAMES = {0: 'unsure', 1: 'linux', 2: 'windows', 3: 'macos', 4: 'ios'}
+MOD_NAMES = ['lctl', 'lsft', 'lalt', 'lgui', 'rctl', 'rsft', 'ralt', 'rgui']
+
+SAFE_RANGE = 0x7E40
+
+# the custom keycodes are shared by every keymap
+DEFAULT_KEYCODES = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'users', 'jari27', 'jari27.h')
+
+BASIC = {0x00: 'NO', 0x01: 'TRNS', 0x28: 'ENT', 0x29: 'ESC', 0x2A: 'BSPC', 0x2B: 'TAB', 0x2C: 'SPC', 0x2D: 'MINS',
+         0x2E: 'EQL', 0x2F: 'LBRC', 0x30: 'RBRC', 0x31: 'BSLS', 0x33: 'SCLN', 0x34: 'QUOT', 0x35: 'GRV', 0x36: 'COMM',
+         0x37: 'DOT', 0x38: 'SLSH', 0x39: 'CAPS', 0x46: 'PSCR', 0x47: 'SCRL', 0x48: 'PAUS', 0x49: 'INS', 0x4A: 'HOME',
+         0x4B: 'PGUP', 0x4C: 'DEL', 0x4D: 'END', 0x4E: 'PGDN', 0x4F: 'RGHT', 0x50: 'LEFT', 0x51: 'DOWN', 0x52: 'UP',
+         0x65: 'APP'}
+BASIC.update({0x04 + i: chr(ord('A') + i) for i in range(26)})
+BASIC.update({0x1E + i: str((i + 1) % 10) for i in range(10)})
+BASIC.update({0x3A + i: 'F%d' % (i + 1) for i in range(12)})
+BASIC.update({0xE0 + i: name.upper() for i, name in enumerate(MOD_NAMES)})
+
+
+def mods_name(mods):
+    names = [name for bit, name in enumerate(MOD_NAMES) if mods & (1 << bit)]
+    return '+'.join(names) if names else '-'
+
+
+def keycode_name(keycode, custom):
+    if keycode in custom:
+        return custom[keycode]
+    if keycode in BASIC:
+        return BASIC[keycode]
+    if keycode <= 0x1FFF:
+        return '%s(%s)' % (mods_name(keycode >> 8 & 0x1F), keycode_name(keycode & 0xFF, custom))
+    if 0x2000 <= keycode <= 0x3FFF:
+        return 'MT(%s,%s)' % (mods_name(keycode >> 8 & 0x1F), keycode_name(keycode & 0xFF, custom))
+    if 0x4000 <= keycode <= 0x4FFF:
+        return 'LT(%d,%s)' % (keycode >> 8 & 0x0F, keycode_name(keycode & 0xFF, custom))
+    if 0x5200 <= keycode <= 0x521F:
+        return 'TO(%d)' % (keycode & 0x1F)
+    if 0x5220 <= keycode <= 0x523F:
+        return 'MO(%d)' % (keycode & 0x1F)
+    if 0x52A0 <= keycode <= 0x52BF:
+        return 'OSM(%s)' % mods_name(keycode & 0x1F)
+    return '0x%04X' % keycode
+
+
+def read_custom_keycodes(path):
+    """Names for enum custom_keycodes, which starts at SAFE_RANGE."""
+    with open(path) as f:
+        source = f.read()
+    # comments first, the ones next to CS_LCBR and CS_RCBR are braces themselves
+    source = re.sub(r'//[^\n]*|/\*.*?\*/', '', source, flags=re.S)
+    match = re.search(r'enum\s+custom_keycodes\s*{(.*?)}', source, re.S)
+    if not match:
+        return {}
+    body = match.group(1)
+    names = {}
+    value = SAFE_RANGE
+    for entry in body.split(','):
+        entry = entry.strip()
+        if not entry:
+            continue
+        name, _, init = entry.partition('=')
+        if init.strip() and init.strip() != 'SAFE_RANGE':
+            return names  # explicit values are not used by the keymaps, stop rather than guess
+        names[value] = name.strip()
+        value += 1
+    return names
+
+
+def decode(line, custom):
+    data = bytes.fromhex(line[2:].strip())
+    if len(data) != 10:
+        return None
+    kind, layer, mods, key, keycode, time = struct.unpack('<BBBBHI', data)
+    event = EVENTS.get(kind, 'type%d' % kind)
+    if event in ('key', 'report'):
+        where = 'r%dc%d %s' % (key & 0x0F, key >> 4 & 0x07, 'down' if key & 0x80 else 'up  ')
+        return '%10d %-7s %s %-18s layer=%d mods=%s' % (time, event, where, keycode_name(keycode, custom), layer,
+                                                        mods_name(mods))
+    if event == 'os':
+        value = OS_NAMES.get(keycode, str(keycode))
+    else:
+        value = str(keycode)
+    return '%10d %-7s %s' % (time, event, value)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--keycodes', default=DEFAULT_KEYCODES,
+                        help='source with enum custom_keycodes to take the names from, users/jari27/jari27.h by default')
+    parser.add_argument('--only', action='store_true', help='drop console output that is not a trace record')
+    parser.add_argument('log', nargs='?', type=argparse.FileType('r'), default=sys.stdin)
+    args = parser.parse_args()
+
+    custom = read_custom_keycodes(args.keycodes) if os.path.exists(args.keycodes) else {}
+    for line in args.log:
+        # qmk console prefixes every line with the device name
+        start = line.find('#T')
+        decoded = None
+        if start >= 0:
+            try:
+                decoded = decode(line[start:], custom)
+            except ValueError:
+                pass
+        if decoded:
+            print(decoded)
+        elif not args.only:
+            sys.stdout.write(line)
+
+
+if __name__ == '__main__':
+    main()
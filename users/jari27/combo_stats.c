@@ -0,0 +1,123 @@
+#include "combo_stats.h"
+
+#ifndef COMBO_ONLY_FROM_LAYER
+#    define COMBO_ONLY_FROM_LAYER 0
+#endif
+#define COMBO_STATS_MAX 16
+#define NO_KEY 0xFF
+
+_Static_assert(MATRIX_ROWS * MATRIX_COLS <= 64, "key positions do not fit the combo masks");
+
+typedef struct {
+    uint16_t hits;
+    uint16_t near_misses;
+    uint16_t timeouts;
+} combo_counters_t;
+
+// the key positions of every combo, looked up once instead of walking the combo keys on every event
+static uint64_t         combo_masks[COMBO_STATS_MAX];
+static uint64_t         combo_keys;
+static uint8_t          combos;
+static combo_counters_t counters[COMBO_STATS_MAX];
+
+// the combo key that went down last and is not accounted for yet
+static uint8_t  pending_key = NO_KEY;
+static uint16_t pending_time;
+
+static uint16_t combo_stats_term(uint8_t index) {
+#ifdef COMBO_TERM_PER_COMBO
+    return get_combo_term(index, combo_get(index));
+#else
+    return COMBO_TERM;
+#endif
+}
+
+static void counter_add(uint16_t *counter) {
+    if (*counter < UINT16_MAX) {
+        (*counter)++;
+    }
+}
+
+void combo_stats_init(void) {
+    combos     = combo_count() < COMBO_STATS_MAX ? combo_count() : COMBO_STATS_MAX;
+    combo_keys = 0;
+    for (uint8_t index = 0; index < combos; index++) {
+        const uint16_t *keys = combo_get(index)->keys;
+        combo_masks[index]   = 0;
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint16_t keycode = keymap_key_to_keycode(COMBO_ONLY_FROM_LAYER, (keypos_t){.row = row, .col = col});
+                for (uint8_t i = 0; pgm_read_word(&keys[i]) != COMBO_END; i++) {
+                    if (pgm_read_word(&keys[i]) == keycode) {
+                        combo_masks[index] |= 1ull << (row * MATRIX_COLS + col);
+                    }
+                }
+            }
+        }
+        combo_keys |= combo_masks[index];
+    }
+}
+
+// settles the pending key once the next key goes down (next) or it is released (NO_KEY), returns true on a hit
+static bool combo_stats_settle(uint8_t next, uint16_t time) {
+    uint64_t pending = 1ull << pending_key;
+    uint16_t gap     = TIMER_DIFF_16(time, pending_time);
+    bool     hit     = false;
+    for (uint8_t index = 0; index < combos; index++) {
+        if (!(combo_masks[index] & pending)) {
+            continue;
+        }
+        uint16_t term = combo_stats_term(index);
+        if (next != NO_KEY && combo_masks[index] == (pending | 1ull << next)) {
+            if (gap < term) {
+                counter_add(&counters[index].hits);
+                hit = true;
+                continue;
+            }
+            if (gap < 2 * term) {
+                counter_add(&counters[index].near_misses);
+                continue;
+            }
+        }
+        if (gap >= term) {
+            counter_add(&counters[index].timeouts);
+        }
+    }
+    pending_key = NO_KEY;
+    return hit;
+}
+
+void combo_stats_key(keyrecord_t *record) {
+    keypos_t key = record->event.key;
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return;
+    }
+    uint8_t position = key.row * MATRIX_COLS + key.col;
+    if (!record->event.pressed) {
+        if (position == pending_key) {
+            combo_stats_settle(NO_KEY, record->event.time);
+        }
+        return;
+    }
+    if (pending_key != NO_KEY && combo_stats_settle(position, record->event.time)) {
+        // both keys went into the combo, so this one does not start a new wait
+        return;
+    }
+    if (combo_keys & (1ull << position)) {
+        pending_key  = position;
+        pending_time = record->event.time;
+    }
+}
+
+void combo_stats_print(void) {
+    uprintf("combo  term     hits  near miss  timeouts\n");
+    for (uint8_t index = 0; index < combos; index++) {
+        uprintf("%5u %5u %8u %10u %9u\n", index, combo_stats_term(index), counters[index].hits,
+                counters[index].near_misses, counters[index].timeouts);
+    }
+}
+
+void combo_stats_reset(void) {
+    memset(counters, 0, sizeof(counters));
+    pending_key = NO_KEY;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// per-combo counters, taken from the matrix events before the combo code sees them:
+// hit       - both keys of the combo went down within its combo term
+// near miss - the other key came, but at most one combo term too late
+// timeout   - one of its keys waited the whole combo term for nothing
+// only two key combos can hit or nearly miss, which is all the keymaps have
+#ifdef COMBO_STATS_ENABLE
+void combo_stats_init(void);
+void combo_stats_key(keyrecord_t *record);
+void combo_stats_print(void);
+void combo_stats_reset(void);
+#else
+#    define combo_stats_init()
+#    define combo_stats_key(record)
+#    define combo_stats_print()
+#    define combo_stats_reset()
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+// shared by every jari27 keymap, the keymap's config.h has the layout and tap-hold settings
+
+#undef PRODUCT
+#define PRODUCT "Jari's Aurora Lily58"
+
+// normal rgb stuff
+#define RGB_MATRIX_MAXIMUM_BRIGHTNESS 128 // prevent crash
+#define ENABLE_RGB_MATRIX_SOLID_COLOR
+#define ENABLE_RGB_MATRIX_BREATHING
+#define RGB_MATRIX_DEFAULT_MODE RGB_MATRIX_CUSTOM_os_indicators // only on eeprom init, a mode picked with RM_NEXT stays
+#define RGB_MATRIX_LED_FLUSH_LIMIT 32 // increase keyboards responsiveness
+
+// oled
+#define OLED_UPDATE_INTERVAL 50 // at rest, see scheduler.h. unchanged widgets are skipped, so this is cheap
+#define OLED_ANIM_WPM_SCALE 120 // the slave art twinkles faster while typing fast, see jari27_oled.c
+#undef OLED_FONT_H
+#ifdef OLED_FONT_SUBSET
+#    include "glcdfont_subset.h"
+#    define OLED_FONT_H "users/jari27/glcdfont_subset.c"
+#else
+#    define OLED_FONT_H "users/jari27/glcdfont_with_win.c"
+#endif
+
+// layers, wpm and os for the slave in one transaction, see split_sync.h
+#define SPLIT_TRANSACTION_IDS_USER USER_SPLIT_SYNC
+// the master's key activity, so the slave's screen and leds also wait while typing on the other half, see scheduler.h
+#define SPLIT_ACTIVITY_ENABLE
+
+// user settings, see user_settings.h, and behind them the saved macro, see macro_recorder.h
+#define USER_SETTINGS_SIZE 16
+#define MACRO_RECORDER_EEPROM_SIZE 128
+#define EECONFIG_USER_DATA_SIZE (USER_SETTINGS_SIZE + MACRO_RECORDER_EEPROM_SIZE)
+
+// saving some more space
+#undef LOCKING_SUPPORT_ENABLE
+#undef LOCKING_RESYNC_ENABLE
@@ -0,0 +1,148 @@
+#include "progmem.h"
+
+// generated by tools/font_subset.py from glcdfont_with_win.c, do not edit. the text characters the screens
+// use, then the tiles from 0x80 as they are in the full font
+
+const unsigned char font[] PROGMEM = {
+  0x23, 0x13, 0x08, 0x64, 0x62, 0x00, // 0x53 '%'
+  0x00, 0x00, 0x60, 0x60, 0x00, 0x00, // 0x54 '.'
+  0x3E, 0x51, 0x49, 0x45, 0x3E, 0x00, // 0x55 '0'
+  0x00, 0x42, 0x7F, 0x40, 0x00, 0x00, // 0x56 '1'
+  0x72, 0x49, 0x49, 0x49, 0x46, 0x00, // 0x57 '2'
+  0x21, 0x41, 0x49, 0x4D, 0x33, 0x00, // 0x58 '3'
+  0x18, 0x14, 0x12, 0x7F, 0x10, 0x00, // 0x59 '4'
+  0x27, 0x45, 0x45, 0x45, 0x39, 0x00, // 0x5A '5'
+  0x3C, 0x4A, 0x49, 0x49, 0x31, 0x00, // 0x5B '6'
+  0x41, 0x21, 0x11, 0x09, 0x07, 0x00, // 0x5C '7'
+  0x36, 0x49, 0x49, 0x49, 0x36, 0x00, // 0x5D '8'
+  0x46, 0x49, 0x49, 0x29, 0x1E, 0x00, // 0x5E '9'
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, // 0x5F ':'
+  0x02, 0x01, 0x59, 0x09, 0x06, 0x00, // 0x60 '?'
+  0x7C, 0x12, 0x11, 0x12, 0x7C, 0x00, // 0x61 'A'
+  0x7F, 0x49, 0x49, 0x49, 0x36, 0x00, // 0x62 'B'
+  0x3E, 0x41, 0x41, 0x41, 0x22, 0x00, // 0x63 'C'
+  0x7F, 0x41, 0x41, 0x41, 0x3E, 0x00, // 0x64 'D'
+  0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, // 0x65 'E'
+  0x7F, 0x09, 0x09, 0x09, 0x01, 0x00, // 0x66 'F'
+  0x20, 0x54, 0x54, 0x78, 0x40, 0x00, // 0x67 'a'
+  0x7F, 0x28, 0x44, 0x44, 0x38, 0x00, // 0x68 'b'
+  0x38, 0x44, 0x44, 0x44, 0x28, 0x00, // 0x69 'c'
+  0x38, 0x44, 0x44, 0x28, 0x7F, 0x00, // 0x6A 'd'
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, // 0x6B 'e'
+  0x00, 0x08, 0x7E, 0x09, 0x02, 0x00, // 0x6C 'f'
+  0x18, 0x24, 0x24, 0x1C, 0x78, 0x00, // 0x6D 'g'
+  0x7F, 0x08, 0x04, 0x04, 0x78, 0x00, // 0x6E 'h'
+  0x00, 0x44, 0x7D, 0x40, 0x00, 0x00, // 0x6F 'i'
+  0x20, 0x40, 0x40, 0x3D, 0x00, 0x00, // 0x70 'j'
+  0x7F, 0x10, 0x28, 0x44, 0x00, 0x00, // 0x71 'k'
+  0x00, 0x41, 0x7F, 0x40, 0x00, 0x00, // 0x72 'l'
+  0x7C, 0x04, 0x78, 0x04, 0x78, 0x00, // 0x73 'm'
+  0x7C, 0x08, 0x04, 0x04, 0x78, 0x00, // 0x74 'n'
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00, // 0x75 'o'
+  0x7C, 0x18, 0x24, 0x24, 0x18, 0x00, // 0x76 'p'
+  0x7C, 0x08, 0x04, 0x04, 0x08, 0x00, // 0x77 'r'
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, // 0x78 's'
+  0x04, 0x04, 0x3F, 0x44, 0x24, 0x00, // 0x79 't'
+  0x3C, 0x40, 0x40, 0x20, 0x7C, 0x00, // 0x7A 'u'
+  0x1C, 0x20, 0x40, 0x20, 0x1C, 0x00, // 0x7B 'v'
+  0x3C, 0x40, 0x30, 0x40, 0x3C, 0x00, // 0x7C 'w'
+  0x44, 0x28, 0x10, 0x28, 0x44, 0x00, // 0x7D 'x'
+  0x4C, 0x90, 0x90, 0x90, 0x7C, 0x00, // 0x7E 'y'
+  0x44, 0x64, 0x54, 0x4C, 0x44, 0x00, // 0x7F 'z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x80
+  0x00, 0xF8, 0xFC, 0xFE, 0x1E, 0x1E, // 0x81
+  0x1E, 0xFE, 0x1E, 0x1E, 0x1E, 0xFE, // 0x82
+  0x00, 0xF8, 0x04, 0x02, 0xE2, 0xE2, // 0x83
+  0xE2, 0x02, 0xE2, 0xE2, 0xE2, 0x02, // 0x84
+  0x00, 0xF8, 0x04, 0x22, 0x52, 0xE2, // 0x85
+  0x42, 0x42, 0x42, 0xE2, 0x52, 0x22, // 0x86
+  0x22, 0x22, 0x42, 0x82, 0x02, 0x02, // 0x87
+  0x22, 0x22, 0x02, 0x04, 0xF8, 0x00, // 0x88
+  0x00, 0xF8, 0x04, 0x02, 0x02, 0x82, // 0x89
+  0x42, 0x22, 0x42, 0x82, 0x02, 0x02, // 0x8A
+  0x02, 0x82, 0x42, 0x22, 0x12, 0x22, // 0x8B
+  0x42, 0x82, 0x02, 0x04, 0xF8, 0x00, // 0x8C
+  0x00, 0xF8, 0xFC, 0xDE, 0xAE, 0x1E, // 0x8D
+  0xBE, 0xBE, 0xBE, 0x1E, 0xAE, 0xDE, // 0x8E
+  0xDE, 0xDE, 0xBE, 0x7E, 0xFE, 0xFE, // 0x8F
+  0xDE, 0xDE, 0xFE, 0xFC, 0xF8, 0x00, // 0x90
+  0x00, 0xF8, 0xFC, 0xFE, 0xFE, 0x7E, // 0x91
+  0xBE, 0xDE, 0xBE, 0x7E, 0xFE, 0xFE, // 0x92
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x93
+  0x80, 0x80, 0x40, 0x40, 0x20, 0x20, // 0x94
+  0x10, 0x10, 0x08, 0x08, 0x10, 0x10, // 0x95
+  0x20, 0x20, 0x40, 0x40, 0x80, 0x80, // 0x96
+  0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, // 0x97
+  0xF0, 0xF0, 0xF8, 0xF8, 0xF0, 0xF0, // 0x98
+  0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, // 0x99
+  0x80, 0x80, 0x40, 0x40, 0x20, 0x20, // 0x9A
+  0x10, 0x10, 0x08, 0x08, 0x10, 0x10, // 0x9B
+  0x20, 0x20, 0x40, 0x40, 0x80, 0x80, // 0x9C
+  0x80, 0x80, 0x40, 0xC0, 0x60, 0xA0, // 0x9D
+  0x50, 0xB0, 0x58, 0xA8, 0x50, 0xB0, // 0x9E
+  0x60, 0xA0, 0x40, 0xC0, 0x80, 0x80, // 0x9F
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xA0
+  0x00, 0x1F, 0x3F, 0x7F, 0x71, 0x71, // 0xA1
+  0x71, 0x7F, 0x71, 0x71, 0x71, 0x7F, // 0xA2
+  0x00, 0x1F, 0x20, 0x40, 0x4E, 0x4E, // 0xA3
+  0x4E, 0x40, 0x4E, 0x4E, 0x4E, 0x40, // 0xA4
+  0x00, 0x1F, 0x20, 0x44, 0x4A, 0x47, // 0xA5
+  0x42, 0x42, 0x42, 0x47, 0x4A, 0x44, // 0xA6
+  0x40, 0x40, 0x40, 0x40, 0x41, 0x42, // 0xA7
+  0x44, 0x44, 0x40, 0x20, 0x1F, 0x00, // 0xA8
+  0x00, 0x1F, 0x20, 0x40, 0x41, 0x40, // 0xA9
+  0x40, 0x40, 0x40, 0x40, 0x41, 0x40, // 0xAA
+  0x41, 0x41, 0x4F, 0x48, 0x48, 0x48, // 0xAB
+  0x4F, 0x41, 0x41, 0x20, 0x1F, 0x00, // 0xAC
+  0x00, 0x1F, 0x3F, 0x7B, 0x75, 0x78, // 0xAD
+  0x7D, 0x7D, 0x7D, 0x78, 0x75, 0x7B, // 0xAE
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, // 0xAF
+  0x7B, 0x7B, 0x7F, 0x3F, 0x1F, 0x00, // 0xB0
+  0x00, 0x1F, 0x3F, 0x7F, 0x7E, 0x7F, // 0xB1
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7F, // 0xB2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xB3
+  0x88, 0x88, 0x5D, 0x5D, 0x3E, 0x3E, // 0xB4
+  0x7C, 0x7C, 0xF8, 0xF8, 0x7C, 0x7C, // 0xB5
+  0x3E, 0x3E, 0x5D, 0x5D, 0x88, 0x88, // 0xB6
+  0x88, 0x88, 0x55, 0x55, 0x23, 0x23, // 0xB7
+  0x47, 0x47, 0x8F, 0x8F, 0x47, 0x47, // 0xB8
+  0x23, 0x23, 0x55, 0x55, 0x88, 0x88, // 0xB9
+  0x88, 0x88, 0xD5, 0xD5, 0xE2, 0xE2, // 0xBA
+  0xC4, 0xC4, 0x88, 0x88, 0xC4, 0xC4, // 0xBB
+  0xE2, 0xE2, 0xD5, 0xD5, 0x88, 0x88, // 0xBC
+  0x88, 0x88, 0x5D, 0xD5, 0x6B, 0xB6, // 0xBD
+  0x6D, 0xD6, 0xAD, 0xDA, 0x6D, 0xD6, // 0xBE
+  0x6B, 0xB6, 0x5D, 0xD5, 0x88, 0x88, // 0xBF
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC3
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC4
+  0x04, 0xF8, 0x00, 0x00, 0xF8, 0x04, // 0xC5
+  0x20, 0x1F, 0x00, 0x00, 0x1F, 0x20, // 0xC6
+  0xFC, 0xF8, 0x00, 0x00, 0xF8, 0x04, // 0xC7
+  0x3F, 0x1F, 0x00, 0x00, 0x1F, 0x20, // 0xC8
+  0x04, 0xF8, 0x00, 0x00, 0xF8, 0xFC, // 0xC9
+  0x20, 0x1F, 0x00, 0x00, 0x1F, 0x3F, // 0xCA
+  0xFC, 0xF8, 0x00, 0x00, 0xF8, 0xFC, // 0xCB
+  0x3F, 0x1F, 0x00, 0x00, 0x1F, 0x3F, // 0xCC
+  0xFE, 0x7E, 0xBE, 0xDE, 0xEE, 0xDE, // 0xCD
+  0xBE, 0x7E, 0xFE, 0xFC, 0xF8, 0x00, // 0xCE
+  0x7E, 0x7E, 0x70, 0x77, 0x77, 0x77, // 0xCF
+  0x70, 0x7E, 0x7E, 0x3F, 0x1F, 0x00, // 0xD0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD3
+  0x00, 0x00, 0x01, 0x01, 0x02, 0x02, // 0xD4
+  0x04, 0x04, 0x08, 0x08, 0x04, 0x04, // 0xD5
+  0x02, 0x02, 0x01, 0x01, 0x00, 0x00, // 0xD6
+  0x00, 0x00, 0x01, 0x01, 0x02, 0x02, // 0xD7
+  0x04, 0x04, 0x08, 0x08, 0x04, 0x04, // 0xD8
+  0x02, 0x02, 0x01, 0x01, 0x00, 0x00, // 0xD9
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x03, // 0xDA
+  0x07, 0x07, 0x0F, 0x0F, 0x07, 0x07, // 0xDB
+  0x03, 0x03, 0x01, 0x01, 0x00, 0x00, // 0xDC
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x02, // 0xDD
+  0x05, 0x06, 0x0D, 0x0A, 0x05, 0x06, // 0xDE
+  0x03, 0x02, 0x01, 0x01, 0x00, 0x00, // 0xDF
+};
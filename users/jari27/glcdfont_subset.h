@@ -0,0 +1,19 @@
+#pragma once
+
+// generated by tools/font_subset.py, do not edit. glcdfont_subset.c starts at OLED_FONT_START, the text
+// characters below 0x80 are looked up in FONT_SUBSET_TEXT_MAP, see oled_write_text
+
+#define OLED_FONT_START 83
+#define OLED_FONT_END 223
+
+// clang-format off
+#define FONT_SUBSET_TEXT_MAP \
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0a\x20\x20\x20\x20\x20" \
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20" \
+    "\x20\x20\x20\x20\x20\x53\x20\x20\x20\x20\x20\x20\x20\x20\x54\x20" \
+    "\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f\x20\x20\x20\x20\x60" \
+    "\x20\x61\x62\x63\x64\x65\x66\x20\x20\x20\x20\x20\x20\x20\x20\x20" \
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20" \
+    "\x20\x67\x68\x69\x6a\x6b\x6c\x6d\x6e\x6f\x70\x71\x72\x73\x74\x75" \
+    "\x76\x20\x77\x78\x79\x7a\x7b\x7c\x7d\x7e\x7f\x20\x20\x20\x20\x20"
+// clang-format on
@@ -0,0 +1,355 @@
+#include "jari27.h"
+
+// base keycodes of the shifted symbols, indexed by keycode - CS_LCBR
+static const uint8_t PROGMEM shifted_symbols[] = {
+    [CS_LCBR - CS_LCBR] = KC_LBRC,
+    [CS_RCBR - CS_LCBR] = KC_RBRC,
+    [CS_LPRN - CS_LCBR] = KC_9,
+    [CS_RPRN - CS_LCBR] = KC_0,
+    [CS_LT - CS_LCBR]   = KC_COMMA,
+    [CS_GT - CS_LCBR]   = KC_DOT,
+    [CS_DQUO - CS_LCBR] = KC_QUOTE,
+    [CS_UNDS - CS_LCBR] = KC_MINUS,
+    [CS_AMPR - CS_LCBR] = KC_7,
+    [CS_PERC - CS_LCBR] = KC_5,
+    [CS_AT - CS_LCBR]   = KC_2,
+    [CS_ASTR - CS_LCBR] = KC_8,
+    [CS_PIPE - CS_LCBR] = KC_BACKSLASH,
+    [CS_TILD - CS_LCBR] = KC_GRAVE,
+    [CS_COLN - CS_LCBR] = KC_SEMICOLON,
+    [CS_DLR - CS_LCBR]  = KC_4,
+    [CS_QUES - CS_LCBR] = KC_SLASH,
+    [CS_PLUS - CS_LCBR] = KC_EQUAL,
+    [CS_EXLM - CS_LCBR] = KC_1,
+    [CS_HASH - CS_LCBR] = KC_3,
+    [CS_CIRC - CS_LCBR] = KC_6,
+};
+_Static_assert(sizeof(shifted_symbols) == CS_CIRC - CS_LCBR + 1, "every CS_ symbol needs a base keycode");
+
+// number of shifted symbols held down, they all share the same weak shift
+static uint8_t shifted_symbol_holds = 0;
+
+bool tap_code_with_mods(uint16_t keycode, uint8_t mod_mask) {
+    // sends a single keycode with the correct mod mask.
+    // Esp. useful for combos to prevent sending e.g. } on down and ] on up ignores existing mods
+    const uint8_t mods = get_mods();
+    clear_oneshot_mods();
+    add_mods(mod_mask);
+    tap_code16(keycode);
+    set_mods(mods);
+    return false;
+}
+
+// clang-format off
+static const uint16_t mac_shortcuts[OS_SHORTCUT_COUNT] = {
+    [OS_UNDO]       = LCMD(KC_Z),    [OS_REDO]       = LCMD(KC_Y),
+    [OS_CUT]        = LCMD(KC_X),    [OS_COPY]       = LCMD(KC_C),
+    [OS_PASTE]      = LCMD(KC_V),    [OS_SELECT_ALL] = LCMD(KC_A),
+    [OS_WORD_LEFT]  = LALT(KC_LEFT), [OS_WORD_RIGHT] = LALT(KC_RGHT),
+    [OS_LINE_START] = LCMD(KC_LEFT), [OS_LINE_END]   = LCMD(KC_RGHT),
+};
+static const uint16_t pc_shortcuts[OS_SHORTCUT_COUNT] = {
+    [OS_UNDO]       = LCTL(KC_Z),    [OS_REDO]       = LCTL(KC_Y),
+    [OS_CUT]        = LCTL(KC_X),    [OS_COPY]       = LCTL(KC_C),
+    [OS_PASTE]      = LCTL(KC_V),    [OS_SELECT_ALL] = LCTL(KC_A),
+    [OS_WORD_LEFT]  = LCTL(KC_LEFT), [OS_WORD_RIGHT] = LCTL(KC_RGHT),
+    [OS_LINE_START] = KC_HOME,       [OS_LINE_END]   = KC_END,
+};
+// clang-format on
+_Static_assert(CS_LEND - CS_UNDO + 1 == OS_SHORTCUT_COUNT, "every os shortcut needs a CS_ key");
+
+const os_profile_t os_profiles[] = {
+    {
+        .os         = OS_MACOS,
+        .color      = {MACOS_COLOR},
+        .guard_mods = MOD_BIT_LGUI,
+        .shortcuts  = mac_shortcuts,
+    },
+    {
+        .os        = OS_WINDOWS,
+        .color     = {WINDOWS_COLOR},
+        .remaps    = pc_remaps,
+        .shortcuts = pc_shortcuts,
+    },
+    {
+        .os        = OS_LINUX,
+        .color     = {LINUX_COLOR},
+        .remaps    = pc_remaps,
+        .shortcuts = pc_shortcuts,
+    },
+};
+const uint8_t os_profile_count = ARRAY_SIZE(os_profiles);
+
+static bool process_shifted_symbol(uint16_t keycode, bool pressed) {
+    // shift and the base key go out in a single report, so the host never sees the unshifted key.
+    // the weak shift is only dropped once the last held symbol is released, which keeps rolls like ( into ) intact
+    const uint8_t base_keycode = pgm_read_byte(&shifted_symbols[keycode - CS_LCBR]);
+    if (pressed) {
+        shifted_symbol_holds++;
+        add_weak_mods(MOD_BIT(KC_LSFT));
+        add_key(base_keycode);
+    } else {
+        del_key(base_keycode);
+        if (shifted_symbol_holds > 0 && --shifted_symbol_holds == 0) {
+            del_weak_mods(MOD_BIT(KC_LSFT));
+        }
+    }
+    send_keyboard_report();
+    return false;
+}
+
+__attribute__((weak)) bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+
+static bool process_record_jari27(uint16_t keycode, keyrecord_t *record) {
+    switch (keycode) {
+        case CS_LTCY:
+            if (record->event.pressed) {
+                latency_stats_print();
+                tapping_learn_print();
+                if (get_mods() & MOD_MASK_SHIFT) {
+                    latency_stats_reset();
+                }
+            }
+            return false;
+        case CS_CMBS:
+            if (record->event.pressed) {
+                combo_stats_print();
+                if (get_mods() & MOD_MASK_SHIFT) {
+                    combo_stats_reset();
+                }
+            }
+            return false;
+        case CS_TYPS:
+            if (record->event.pressed) {
+                typing_stats_shown = !typing_stats_shown;
+                typing_stats_print();
+                if (get_mods() & MOD_MASK_SHIFT) {
+                    typing_stats_reset();
+                }
+            }
+            return false;
+        case CS_PROF:
+            if (record->event.pressed) {
+                profiler_toggle_oled();
+                profiler_print();
+                if (get_mods() & MOD_MASK_SHIFT) {
+                    profiler_reset();
+                }
+            }
+            return false;
+        case CS_MREC:
+            if (record->event.pressed) {
+                macro_recorder_toggle(get_mods() & MOD_MASK_SHIFT);
+            }
+            return false;
+        case CS_MPLY:
+            if (record->event.pressed) {
+                macro_recorder_play();
+            }
+            return false;
+        // deal with os swapping and modifying some keys
+        case CS_SWAP_OS:
+            if (record->event.pressed) {
+                if (get_mods() & MOD_MASK_SHIFT) {
+                    // shift drops the override and goes back to what os detection found
+                    user_settings.os = OS_UNSURE;
+                    os_profile_select(detected_host_os());
+                } else {
+                    os_profile_next();
+                    user_settings.os = selected_os;
+                }
+                user_settings_changed();
+                trace_state(TRACE_OS, selected_os);
+#ifdef RGB_MATRIX_ENABLE
+                if (rgb_matrix_is_enabled()) {
+                    rgb_matrix_sethsv_noeeprom(os_profile->color.h, os_profile->color.s, rgb_matrix_get_val());
+                }
+#endif
+            }
+            return false;
+#ifdef RGB_MATRIX_ENABLE
+        // the os decides the colour, so only the brightness is kept, with the other user settings
+        case RM_VALU:
+        case RM_VALD:
+            if (record->event.pressed) {
+                if (keycode == RM_VALU) {
+                    rgb_matrix_increase_val_noeeprom();
+                } else {
+                    rgb_matrix_decrease_val_noeeprom();
+                }
+                user_settings.rgb_val = rgb_matrix_get_val();
+                user_settings_changed();
+            }
+            return false;
+#endif
+        case QK_PERSISTENT_DEF_LAYER ... QK_PERSISTENT_DEF_LAYER_MAX:
+            // stored with the user settings as well, instead of an eeprom write straight from the key press
+            if (record->event.pressed) {
+                user_settings.default_layer = QK_PERSISTENT_DEF_LAYER_GET_LAYER(keycode);
+                default_layer_set((layer_state_t)1 << user_settings.default_layer);
+                user_settings_changed();
+            }
+            return false;
+        // custom keys for combos
+        case CS_LCBR ... CS_CIRC:
+            return process_shifted_symbol(keycode, record->event.pressed);
+        case CS_UNDO ... CS_LEND:
+            os_shortcut_hold(keycode - CS_UNDO, record->event.pressed);
+            return false;
+// macros
+#ifdef YUBIKEY_CODE
+        case CS_YUBI:
+            if (record->event.pressed) {
+#    ifdef YUBIKEY_CODE_NKRO
+                static const uint8_t PROGMEM yubikey_code[] = YUBIKEY_CODE_NKRO;
+                if (nkro_string_check(PSTR(YUBIKEY_CODE)) == YUBIKEY_CODE_NKRO_CHECK) {
+                    nkro_send_packed(yubikey_code);
+                    return false;
+                }
+                dprintf("nkro: nkro_strings.h is older than YUBIKEY_CODE\n");
+#    endif
+                SEND_STRING(YUBIKEY_CODE);
+            }
+            return false;
+#endif /* ifdef YUBIKEY_CODE */
+    }
+    return true;
+}
+
+bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    latency_key_detected(record);
+    combo_stats_key(record);
+    return true;
+}
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    uint8_t section = profiler_enter(PROFILER_RECORD);
+    trace_key(keycode, record);
+    tapping_learn_record(keycode, record);
+    typing_stats_record(keycode, record);
+    macro_recorder_record(record);
+    latency_user_enter(record);
+    // keys that act differently on this os are swapped for their replacement once, before anything looks at them
+    uint16_t remapped = os_profile_remap(keycode, record);
+    if (remapped != keycode) {
+        keycode         = remapped;
+        record->keycode = keycode;
+    }
+    bool cont = process_record_keymap(keycode, record) && process_record_jari27(keycode, record);
+    latency_user_exit(record, cont);
+    profiler_mark(section);
+    return cont;
+}
+
+void post_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    latency_report_queued(record);
+    trace_report(keycode, record);
+}
+
+layer_state_t layer_state_set_user(layer_state_t state) {
+    trace_state(TRACE_LAYER, get_highest_layer(state));
+    return state;
+}
+
+layer_state_t default_layer_state_set_user(layer_state_t state) {
+    trace_state(TRACE_DEFAULT_LAYER, get_highest_layer(state));
+    return state;
+}
+
+void matrix_scan_user(void) {
+    profiler_mark(PROFILER_CORE);
+}
+
+void matrix_slave_scan_user(void) {
+    profiler_mark(PROFILER_CORE);
+}
+
+void housekeeping_task_user(void) {
+    profiler_loop();
+    trace_log_task();
+    user_settings_task();
+    typing_stats_task();
+    macro_recorder_task();
+    profiler_mark(PROFILER_SPLIT);
+    split_sync_task();
+    // the next loop starts with the usb task
+    profiler_mark(PROFILER_USB);
+}
+
+bool shutdown_user(bool jump_to_bootloader) {
+    // QK_BOOT should not lose changes that were still waiting for the keyboard to go idle
+    user_settings_flush();
+    macro_recorder_flush();
+    return true;
+}
+
+bool caps_word_press_user(uint16_t keycode) {
+    switch (keycode) {
+        // continue and apply shift
+        case KC_A ... KC_Z:
+            add_weak_mods(MOD_BIT(KC_LSFT)); // apply shift to next key.
+            return true;
+        // keys that are unmodified but also don't break caps word
+        case KC_MINS:
+        case KC_1 ... KC_0:
+        case KC_BSPC:
+        case KC_DEL:
+        case KC_UNDS:
+        case CS_UNDS:
+            return true;
+        default:
+            return false; // deactivate Caps Word.
+    }
+}
+
+__attribute__((weak)) void keyboard_post_init_keymap(void) {}
+
+void keyboard_post_init_user(void) {
+    user_settings_init();
+    tapping_learn_init();
+    macro_recorder_init();
+    scheduler_init();
+    combo_stats_init();
+    split_sync_init();
+    if (user_settings.default_layer < keymap_layer_count()) {
+        default_layer_set((layer_state_t)1 << user_settings.default_layer);
+    }
+    // turn off liatris leds
+    setPinOutput(24);
+    writePinHigh(24);
+#ifdef RGB_MATRIX_ENABLE
+    // necessary to set some stuff here to ensure the color is set correctly after detecting os
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_sethsv_noeeprom(HSV_OFF); // this should work even after initing the rgb matrix from eeprom
+#endif
+    keyboard_post_init_keymap();
+}
+
+#ifdef RGB_MATRIX_ENABLE
+bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    uint8_t section = profiler_enter(PROFILER_RGB);
+    // the custom effects already drew the indicators along with the base colour
+    uint8_t mode = rgb_matrix_get_mode();
+    if (mode != RGB_MATRIX_CUSTOM_os_indicators && mode != RGB_MATRIX_CUSTOM_os_indicators_breathing) {
+        led_overlays_set_color(led_min, led_max);
+    }
+    profiler_mark(section);
+    return false;
+}
+#endif
+
+bool process_detected_host_os_user(os_variant_t detected_os) {
+    // this runs after init of matrix from eeprom
+    // an os picked with CS_SWAP_OS wins over detection
+    os_variant_t os = user_settings.os != OS_UNSURE ? user_settings.os : detected_os;
+    os_profile_select(os);
+#ifdef RGB_MATRIX_ENABLE
+    hsv_t goal_color = os == OS_UNSURE ? (hsv_t){HSV_RED} : os_profile->color;
+    // brightness as last set with RM_VALU/RM_VALD
+    rgb_matrix_sethsv_noeeprom(goal_color.h, goal_color.s, user_settings.rgb_val);
+#endif
+    trace_state(TRACE_OS, selected_os);
+    return true; // does nothing
+}
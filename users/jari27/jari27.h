@@ -0,0 +1,93 @@
+#pragma once
+
+// shared by every jari27 keymap. jari27.c implements the QMK _user hooks and calls the _keymap ones below, so a keymap
+// only has its layers, combos, tap-hold keys and screens
+
+#include QMK_KEYBOARD_H
+#include "combo_stats.h"
+#include "latency_stats.h"
+#include "led_masks.h"
+#include "macro_recorder.h"
+#include "nkro_send.h"
+#include "oled_widgets.h"
+#include "os_profile.h"
+#include "profiler.h"
+#include "scheduler.h"
+#include "split_sync.h"
+#include "tapping_learn.h"
+#include "typing_stats.h"
+#include "trace_log.h"
+#include "user_settings.h"
+
+#define MOD_CAG (MOD_LCTL | MOD_LALT | MOD_LGUI)
+
+// rgb matrix color on for os detection
+#define WINDOWS_COLOR HSV_GREEN
+#define MACOS_COLOR HSV_BLUE
+#define LINUX_COLOR HSV_GOLD
+
+enum custom_keycodes {
+    CS_YUBI = SAFE_RANGE, // sends the yubikey pass
+    CS_SWAP_OS,           // allows overriding the detected os
+    CS_LTCY,              // prints keystroke latency stats and the learned tapping terms, shift resets the latency
+    CS_CMBS,              // prints combo hits, near misses and timeouts, shift also resets them
+    CS_TYPS,              // shows or hides the typing stats on the slave oled and prints them, shift also resets them
+    CS_PROF,              // shows or hides the main loop profile on the master oled and prints it, shift also resets it
+    CS_MREC,              // starts or stops recording a macro, shift saves it to the eeprom
+    CS_MPLY,              // plays the recorded macro
+    CS_UNDO,              // ctrl + z, CS_UNDO to CS_LEND are in the order of enum os_shortcut
+    CS_REDO,              // ctrl + y
+    CS_CUT,               // ctrl + x
+    CS_COPY,              // ctrl + c
+    CS_PAST,              // ctrl + v
+    CS_SELA,              // ctrl + a
+    CS_WLFT,              // ctrl + left
+    CS_WRGT,              // ctrl + right
+    CS_LSTR,              // home
+    CS_LEND,              // end
+    CS_LCBR,              // {
+    CS_RCBR,              // }
+    CS_LPRN,              // (
+    CS_RPRN,              // )
+    CS_LT,                // <
+    CS_GT,                // >
+    CS_DQUO,              // "
+    CS_UNDS,              // _
+    CS_AMPR,              // &
+    CS_PERC,              // %
+    CS_AT,                // @
+    CS_ASTR,              // *
+    CS_PIPE,              // |
+    CS_TILD,              // ~
+    CS_COLN,              // :
+    CS_DLR,               // $
+    CS_QUES,              // $
+    CS_PLUS,              // +
+    CS_EXLM,              // !
+    CS_HASH,              // #
+    CS_CIRC,              // ^
+    KEYMAP_SAFE_RANGE,    // keycodes of a single keymap start here
+};
+
+bool tap_code_with_mods(uint16_t keycode, uint8_t mod_mask);
+
+// weak in jari27.c, for the keymaps to override
+bool process_record_keymap(uint16_t keycode, keyrecord_t *record); // gets the keycode after the os remap
+void keyboard_post_init_keymap(void);
+
+#ifdef OLED_ENABLE
+// from the keyboard
+void render_logo(void);
+void render_space(void);
+void render_mod_status_ctrl_shift(uint8_t modifiers);
+
+// widgets for the master screen, see jari27_oled.c
+void render_mods_gui_alt(void);
+void render_mods_ctrl_shift(void);
+void render_os_logo(void); // two lines
+void render_version(void);
+
+// the master status screen top to bottom, defined in keymap.c. the slave screen is the same for every keymap
+extern const oled_widget_t oled_master_widgets[];
+extern const uint8_t       oled_master_widget_count;
+#endif
@@ -0,0 +1,213 @@
+#include "jari27.h"
+#include "oled_art.h"
+#include "oled_sprite.h"
+
+#ifndef OLED_ANIM_FRAME_MS
+#    define OLED_ANIM_FRAME_MS 400
+#endif
+
+static void render_mod_status_gui_alt_os_specific(uint8_t modifiers) {
+    // windows
+    static const char PROGMEM win_off_1[] = {0x83, 0x84, 0};
+    static const char PROGMEM win_off_2[] = {0xa3, 0xa4, 0};
+    static const char PROGMEM win_on_1[]  = {0x81, 0x82, 0};
+    static const char PROGMEM win_on_2[]  = {0xa1, 0xa2, 0};
+
+    // command
+    static const char PROGMEM gui_off_1[] = {0x85, 0x86, 0};
+    static const char PROGMEM gui_off_2[] = {0xa5, 0xa6, 0};
+    static const char PROGMEM gui_on_1[]  = {0x8d, 0x8e, 0};
+    static const char PROGMEM gui_on_2[]  = {0xad, 0xae, 0};
+
+    static const char PROGMEM alt_off_1[] = {0x87, 0x88, 0};
+    static const char PROGMEM alt_off_2[] = {0xa7, 0xa8, 0};
+    static const char PROGMEM alt_on_1[]  = {0x8f, 0x90, 0};
+    static const char PROGMEM alt_on_2[]  = {0xaf, 0xb0, 0};
+
+    // fillers between the modifier icons bleed into the icon frames
+    static const char PROGMEM off_off_1[] = {0xc5, 0};
+    static const char PROGMEM off_off_2[] = {0xc6, 0};
+    static const char PROGMEM on_off_1[]  = {0xc7, 0};
+    static const char PROGMEM on_off_2[]  = {0xc8, 0};
+    static const char PROGMEM off_on_1[]  = {0xc9, 0};
+    static const char PROGMEM off_on_2[]  = {0xca, 0};
+    static const char PROGMEM on_on_1[]   = {0xcb, 0};
+    static const char PROGMEM on_on_2[]   = {0xcc, 0};
+
+    if (selected_os == OS_WINDOWS) {
+        if (modifiers & MOD_MASK_GUI) {
+            oled_write_P(win_on_1, false);
+        } else {
+            oled_write_P(win_off_1, false);
+        }
+    } else {
+        if (modifiers & MOD_MASK_GUI) {
+            oled_write_P(gui_on_1, false);
+        } else {
+            oled_write_P(gui_off_1, false);
+        }
+    }
+
+    if ((modifiers & MOD_MASK_GUI) && (modifiers & MOD_MASK_ALT)) {
+        oled_write_P(on_on_1, false);
+    } else if (modifiers & MOD_MASK_GUI) {
+        oled_write_P(on_off_1, false);
+    } else if (modifiers & MOD_MASK_ALT) {
+        oled_write_P(off_on_1, false);
+    } else {
+        oled_write_P(off_off_1, false);
+    }
+
+    if (modifiers & MOD_MASK_ALT) {
+        oled_write_P(alt_on_1, false);
+    } else {
+        oled_write_P(alt_off_1, false);
+    }
+
+    if (selected_os == OS_WINDOWS) {
+        if (modifiers & MOD_MASK_GUI) {
+            oled_write_P(win_on_2, false);
+        } else {
+            oled_write_P(win_off_2, false);
+        }
+    } else {
+        if (modifiers & MOD_MASK_GUI) {
+            oled_write_P(gui_on_2, false);
+        } else {
+            oled_write_P(gui_off_2, false);
+        }
+    }
+
+    if ((modifiers & MOD_MASK_GUI) && (modifiers & MOD_MASK_ALT)) {
+        oled_write_P(on_on_2, false);
+    } else if (modifiers & MOD_MASK_GUI) {
+        oled_write_P(on_off_2, false);
+    } else if (modifiers & MOD_MASK_ALT) {
+        oled_write_P(off_on_2, false);
+    } else {
+        oled_write_P(off_off_2, false);
+    }
+
+    if (modifiers & MOD_MASK_ALT) {
+        oled_write_P(alt_on_2, false);
+    } else {
+        oled_write_P(alt_off_2, false);
+    }
+}
+
+void render_os_logo(void) {
+    const uint8_t *art;
+    switch (selected_os) {
+        case OS_WINDOWS:
+            art = art_windows;
+            break;
+        case OS_LINUX:
+            art = art_linux;
+            break;
+        case OS_MACOS:
+        case OS_IOS:
+            art = art_apple;
+            break;
+        default:
+            return;
+    }
+    // the logos differ in size and a sprite only draws its own box, so the previous one is blanked first
+    oled_write_text_P(PSTR("          "));
+    oled_sprite_draw(art, 0, oled_widget_line());
+}
+
+void render_version(void) {
+#ifdef KEYMAP_VERSION
+    oled_write_text_P(PSTR(KEYMAP_VERSION));
+#else
+    oled_write_text_P(PSTR("jari"));
+#endif /* ifdef KEYMAP_VERSION */
+    oled_advance_page(true);
+}
+
+// frame time of the slave art, optionally faster the faster the typing is: from OLED_ANIM_FRAME_MS at 0 wpm down to
+// a quarter of it at OLED_ANIM_WPM_SCALE wpm
+static uint16_t anim_frame_ms(uint8_t wpm) {
+#ifdef OLED_ANIM_WPM_SCALE
+    if (wpm > OLED_ANIM_WPM_SCALE) {
+        wpm = OLED_ANIM_WPM_SCALE;
+    }
+    return OLED_ANIM_FRAME_MS - (uint32_t)OLED_ANIM_FRAME_MS * 3 / 4 * wpm / OLED_ANIM_WPM_SCALE;
+#else
+    return OLED_ANIM_FRAME_MS;
+#endif
+}
+
+void render_mods_gui_alt(void) {
+    render_mod_status_gui_alt_os_specific(get_mods() | get_oneshot_mods());
+}
+
+void render_mods_ctrl_shift(void) {
+    render_mod_status_ctrl_shift(get_mods() | get_oneshot_mods());
+}
+
+bool oled_task_user(void) {
+    uint8_t section = profiler_enter(PROFILER_OLED);
+    // while typing the screens are drawn every SCHEDULER_OLED_MS, the master widgets a few at a time
+    if (!scheduler_due(SCHEDULER_OLED)) {
+        profiler_mark(section);
+        return false;
+    }
+    // 5 columns, 16 rows for writing; or 32*128 in pixels
+    // the art is drawn from the images in art/, packed by tools/sprite_pack.py
+    if (is_keyboard_master()) {
+        // the profile replaces the widgets while it is shown, they are drawn again from scratch once it is gone
+        static bool profile_shown = false;
+        if (profiler_oled_shown() != profile_shown) {
+            profile_shown = profiler_oled_shown();
+            oled_clear();
+            oled_widgets_invalidate();
+        }
+        if (profile_shown) {
+            profiler_render();
+        } else {
+            // only widgets whose inputs changed are drawn again
+            oled_widgets_render(oled_master_widgets, oled_master_widget_count,
+                                scheduler_typing() ? SCHEDULER_OLED_WIDGETS : oled_master_widget_count);
+        }
+    } else {
+        static bool                   art_drawn   = false;
+        static bool                   stats_drawn = false;
+        static uint8_t                last_wpm    = 0;
+        static typing_stats_summary_t last_stats;
+        static oled_anim_state_t      aurora;
+        // CS_TYPS on the master swaps the art for the typing stats and back, only a swap draws the screen from scratch
+        if (typing_stats_shown) {
+            if (!stats_drawn || memcmp(&typing_stats_summary, &last_stats, sizeof(last_stats))) {
+                oled_set_cursor(0, 0);
+                typing_stats_render(&typing_stats_summary);
+                if (!stats_drawn) {
+                    // the stats take the top 13 lines, the rest of the art goes
+                    oled_write_text_P(PSTR("               "));
+                }
+                last_stats = typing_stats_summary;
+            }
+            stats_drawn = true;
+            art_drawn   = false;
+            profiler_mark(section);
+            return false;
+        }
+        stats_drawn = false;
+        // the buffer survives the oled timeout, so after the first draw only the bytes a frame of the art changes
+        // and the wpm cell below it are written, the wpm only when the value changed
+        uint8_t wpm = get_current_wpm();
+        if (!art_drawn) {
+            oled_anim_start(&aurora, &anim_aurora, 0, 0);
+        } else {
+            oled_anim_task(&aurora, anim_frame_ms(wpm));
+        }
+        if (!art_drawn || wpm != last_wpm) {
+            oled_set_cursor(2, 15);
+            oled_render_number(wpm);
+            last_wpm = wpm;
+        }
+        art_drawn = true;
+    }
+    profiler_mark(section);
+    return false;
+}
@@ -0,0 +1,121 @@
+#include "latency_stats.h"
+#include "timer_us.h"
+
+// 16 exact buckets below 16us, then 4 buckets per power of two up to ~1s
+#define LATENCY_BUCKETS 80
+
+typedef struct {
+    uint16_t buckets[LATENCY_BUCKETS];
+    uint32_t count;
+    uint32_t max;
+} latency_histogram_t;
+
+static latency_histogram_t histograms[LATENCY_STAGE_COUNT];
+
+// timestamps of the record in flight, a press and release of the same key can both be waiting for a tap decision
+static uint32_t detected_us[2][MATRIX_ROWS][MATRIX_COLS];
+static uint32_t record_detected_us;
+static uint32_t user_enter_us;
+static uint32_t user_exit_us;
+static bool     record_pending;
+
+static uint8_t latency_bucket(uint32_t us) {
+    if (us < 16) {
+        return us;
+    }
+    uint8_t octave = 31 - __builtin_clz(us);
+    uint8_t bucket = 16 + (octave - 4) * 4 + ((us >> (octave - 2)) & 3);
+    return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+}
+
+static uint32_t latency_bucket_limit(uint8_t bucket) {
+    if (bucket < 16) {
+        return bucket;
+    }
+    uint8_t octave = 4 + (bucket - 16) / 4;
+    uint8_t sub    = (bucket - 16) % 4;
+    return ((uint32_t)(4 + sub + 1) << (octave - 2)) - 1;
+}
+
+static void latency_add(enum latency_stage stage, uint32_t us) {
+    latency_histogram_t *histogram = &histograms[stage];
+    uint8_t              bucket    = latency_bucket(us);
+    if (histogram->buckets[bucket] < UINT16_MAX) {
+        histogram->buckets[bucket]++;
+    }
+    histogram->count++;
+    if (us > histogram->max) {
+        histogram->max = us;
+    }
+}
+
+static uint32_t latency_percentile(const latency_histogram_t *histogram, uint8_t percent) {
+    uint32_t goal  = ((uint32_t)histogram->count * percent + 99) / 100;
+    uint32_t total = 0;
+    for (uint8_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+        total += histogram->buckets[bucket];
+        if (total >= goal) {
+            uint32_t limit = latency_bucket_limit(bucket);
+            return limit < histogram->max ? limit : histogram->max;
+        }
+    }
+    return histogram->max;
+}
+
+static bool latency_is_matrix_key(keyrecord_t *record) {
+    return record->event.key.row < MATRIX_ROWS && record->event.key.col < MATRIX_COLS;
+}
+
+void latency_key_detected(keyrecord_t *record) {
+    if (latency_is_matrix_key(record)) {
+        detected_us[record->event.pressed][record->event.key.row][record->event.key.col] = timer_us_now();
+    }
+}
+
+void latency_user_enter(keyrecord_t *record) {
+    user_enter_us      = timer_us_now();
+    record_detected_us = 0;
+    if (latency_is_matrix_key(record)) {
+        record_detected_us = detected_us[record->event.pressed][record->event.key.row][record->event.key.col];
+        if (record_detected_us) {
+            latency_add(LATENCY_HOLD, user_enter_us - record_detected_us);
+        }
+    }
+}
+
+void latency_user_exit(keyrecord_t *record, bool cont) {
+    user_exit_us = timer_us_now();
+    latency_add(LATENCY_USER, user_exit_us - user_enter_us);
+    record_pending = true;
+    if (!cont) {
+        // the keymap handled the key itself, whatever it sent is already queued
+        latency_report_queued(record);
+    }
+}
+
+void latency_report_queued(keyrecord_t *record) {
+    if (!record_pending) {
+        return;
+    }
+    uint32_t now   = timer_us_now();
+    record_pending = false;
+    latency_add(LATENCY_ACTION, now - user_exit_us);
+    if (record_detected_us) {
+        latency_add(LATENCY_TOTAL, now - record_detected_us);
+    }
+}
+
+void latency_stats_print(void) {
+    static const char *const names[LATENCY_STAGE_COUNT] = {"hold", "user", "action", "total"};
+    uprintf("latency (us)   count      p50      p95      p99      max\n");
+    for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        const latency_histogram_t *histogram = &histograms[stage];
+        uprintf("%-8s %11lu %8lu %8lu %8lu %8lu\n", names[stage], (unsigned long)histogram->count,
+                (unsigned long)latency_percentile(histogram, 50), (unsigned long)latency_percentile(histogram, 95),
+                (unsigned long)latency_percentile(histogram, 99), (unsigned long)histogram->max);
+    }
+}
+
+void latency_stats_reset(void) {
+    memset(histograms, 0, sizeof(histograms));
+}
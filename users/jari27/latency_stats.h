@@ -0,0 +1,32 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// per-stage keystroke latency, in microseconds:
+// hold   - matrix detection until process_record_user (combo and tap-hold decisions)
+// user   - time spent in process_record_user
+// action - process_record_user exit until the report is queued
+// total  - matrix detection until the report is queued
+enum latency_stage {
+    LATENCY_HOLD = 0,
+    LATENCY_USER,
+    LATENCY_ACTION,
+    LATENCY_TOTAL,
+    LATENCY_STAGE_COUNT,
+};
+
+#ifdef LATENCY_STATS_ENABLE
+void latency_key_detected(keyrecord_t *record);
+void latency_user_enter(keyrecord_t *record);
+void latency_user_exit(keyrecord_t *record, bool cont);
+void latency_report_queued(keyrecord_t *record);
+void latency_stats_print(void);
+void latency_stats_reset(void);
+#else
+#    define latency_key_detected(record)
+#    define latency_user_enter(record)
+#    define latency_user_exit(record, cont)
+#    define latency_report_queued(record)
+#    define latency_stats_print()
+#    define latency_stats_reset()
+#endif
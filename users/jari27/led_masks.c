@@ -0,0 +1,38 @@
+#include <string.h>
+
+#include "led_masks.h"
+
+void led_mask_build(led_mask_t *mask, uint8_t layer, bool (*match)(uint16_t keycode)) {
+    memset(mask, 0, sizeof(*mask));
+    for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+        for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+            uint8_t index = g_led_config.matrix_co[row][col];
+            if (index < RGB_MATRIX_LED_COUNT && match(keymap_key_to_keycode(layer, (keypos_t){col, row}))) {
+                mask->bits[index / 32] |= 1UL << (index % 32);
+            }
+        }
+    }
+}
+
+void led_mask_set_color(const led_mask_t *mask, uint8_t led_min, uint8_t led_max, rgb_t rgb) {
+    // only the words overlapping the range, and within those only the set bits
+    for (uint8_t word = led_min / 32; word * 32 < led_max; ++word) {
+        uint32_t bits = mask->bits[word];
+        while (bits) {
+            uint8_t index = word * 32 + __builtin_ctz(bits);
+            bits &= bits - 1;
+            if (index >= led_min && index < led_max) {
+                rgb_matrix_set_color(index, rgb.r, rgb.g, rgb.b);
+            }
+        }
+    }
+}
+
+void led_overlays_set_color(uint8_t led_min, uint8_t led_max) {
+    const led_overlay_t *overlays;
+    uint8_t              count = led_overlays_user(&overlays);
+    // last to first, so the earlier overlays end up on top like in the custom effect
+    while (count--) {
+        led_mask_set_color(overlays[count].mask, led_min, led_max, overlays[count].rgb);
+    }
+}
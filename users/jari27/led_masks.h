@@ -0,0 +1,33 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+#define LED_MASK_WORDS ((RGB_MATRIX_LED_COUNT + 31) / 32)
+
+// one bit per rgb matrix led
+typedef struct {
+    uint32_t bits[LED_MASK_WORDS];
+} led_mask_t;
+
+// sets the bit of every led whose key on layer matches, the keymap is in flash so this only has to run once
+void led_mask_build(led_mask_t *mask, uint8_t layer, bool (*match)(uint16_t keycode));
+
+// sets the colour of the leds in the mask that fall within [led_min, led_max)
+void led_mask_set_color(const led_mask_t *mask, uint8_t led_min, uint8_t led_max, rgb_t rgb);
+
+static inline bool led_mask_test(const led_mask_t *mask, uint8_t index) {
+    return mask->bits[index / 32] & (1UL << (index % 32));
+}
+
+// a colour for the leds in a mask, drawn over the base colour
+typedef struct {
+    const led_mask_t *mask;
+    rgb_t             rgb;
+} led_overlay_t;
+
+// the overlays for the current layer, earlier ones win where masks overlap. implemented in keymap.c, used by both the
+// custom effect in rgb_matrix_user.inc and the indicators for the built in effects
+uint8_t led_overlays_user(const led_overlay_t **overlays);
+
+// sets the colours of all overlays within [led_min, led_max), for effects that do not draw them themselves
+void led_overlays_set_color(uint8_t led_min, uint8_t led_max);
@@ -0,0 +1,368 @@
+#include <string.h>
+
+#include "macro_recorder.h"
+
+// the recorder sits between QMK and the usb driver and turns every report into the keys and modifiers that went down
+// or up since the one before. they are stored as events, each a token byte that can be followed by a keycode and a
+// delay:
+//
+//   bit 7     pressed
+//   bit 6     a delay follows: the time since the previous event in DELAY_TICK_MS as a varint, 7 bits a byte, the
+//             low ones first, bit 7 set when another byte follows
+//   bits 0-5  0x00-0x37 the low bits of the keycode, the top two are those of the last keycode that was not a modifier
+//             0x38-0x3e a modifier, left control to right alt
+//             0x3f      the keycode is in the next byte
+//
+// letters, digits and most punctuation are below 0x40, the arrows and the rest of the navigation keys share 0x40-0x7f,
+// the events of one report have no delay and the gaps between keys fit a byte, so an event is two bytes on average when
+// typing. it is four at most, a keycode byte and a pause of two delay bytes. QMK's dynamic macros keep a whole
+// keyrecord_t per event.
+
+#ifndef MACRO_RECORDER_PAUSE_MS
+#    define MACRO_RECORDER_PAUSE_MS 500 // shorter gaps are played without waiting, longer ones as recorded
+#endif
+#ifndef MACRO_RECORDER_SAVE_IDLE_MS
+#    define MACRO_RECORDER_SAVE_IDLE_MS 1000 // since the last key, like the user settings
+#endif
+
+#define TOKEN_PRESSED 0x80
+#define TOKEN_DELAY 0x40
+#define TOKEN_CODE 0x3F
+#define CODE_MOD 0x38
+#define CODE_FULL 0x3F
+#define PREFIX 0xC0
+#define VARINT_MORE 0x80
+#define DELAY_TICK_MS 4 // only pauses are played, this keeps the gaps of typing below 128 ticks
+
+#if MACRO_RECORDER_EEPROM_SIZE > 0
+_Static_assert(USER_SETTINGS_SIZE + MACRO_RECORDER_EEPROM_SIZE <= EECONFIG_USER_DATA_SIZE,
+               "EECONFIG_USER_DATA_SIZE is too small for the saved macro");
+_Static_assert(MACRO_RECORDER_EEPROM_SIZE <= 256, "the saved macro has a length byte");
+#endif
+
+typedef struct {
+    uint8_t  keycode;
+    bool     pressed;
+    uint16_t delay;
+} macro_event_t;
+
+static uint8_t  arena[MACRO_RECORDER_SIZE];
+static uint16_t length;
+static uint16_t idle_end; // the end of the recording when nothing was held
+static bool     recording;
+static bool     save_pending;
+
+// the recorder's state while recording
+static uint8_t  record_prefix;
+static uint32_t last_event_time;
+static uint8_t  sent_mods;
+static uint8_t  sent_keys[NKRO_REPORT_BITS];
+
+static host_driver_t *host_driver;
+static host_driver_t  recorder_driver;
+
+static struct {
+    uint16_t      pos;
+    uint8_t       prefix;
+    uint8_t       mods; // the user's, back after the playback
+    bool          paused;
+    uint32_t      paused_at;
+    macro_event_t next; // read but not sent yet
+} play;
+
+static void record_event(uint8_t keycode, bool pressed, uint32_t time) {
+    uint8_t event[4] = {pressed ? TOKEN_PRESSED : 0}; // the delay is clamped to 14 bits, two varint bytes
+    uint8_t size     = 1;
+    uint8_t prefix   = record_prefix;
+    if (IS_MODIFIER_KEYCODE(keycode) && keycode != KC_RIGHT_GUI) {
+        event[0] |= CODE_MOD + keycode - KC_LEFT_CTRL;
+    } else if (!IS_MODIFIER_KEYCODE(keycode) && (keycode & PREFIX) == prefix && (keycode & TOKEN_CODE) < CODE_MOD) {
+        event[0] |= keycode & TOKEN_CODE;
+    } else {
+        event[0] |= CODE_FULL;
+        event[size++] = keycode;
+        if (!IS_MODIFIER_KEYCODE(keycode)) {
+            prefix = keycode & PREFIX;
+        }
+    }
+    uint32_t delay = length ? TIMER_DIFF_32(time, last_event_time) / DELAY_TICK_MS : 0;
+    if (delay) {
+        event[0] |= TOKEN_DELAY;
+        delay = delay > UINT16_MAX / DELAY_TICK_MS ? UINT16_MAX / DELAY_TICK_MS : delay;
+        for (; delay >= VARINT_MORE; delay >>= 7) {
+            event[size++] = (delay & 0x7F) | VARINT_MORE;
+        }
+        event[size++] = delay;
+    }
+    if (length + size > sizeof(arena)) {
+        // full, what was recorded up to the last time nothing was held is kept
+        recording = false;
+        length    = idle_end;
+        dprintf("macro: full, %u bytes\n", length);
+        return;
+    }
+    memcpy(&arena[length], event, size);
+    length += size;
+    record_prefix   = prefix;
+    last_event_time = time;
+}
+
+static void record_report(uint8_t mods, const uint8_t *keys) {
+    // releases first, then the modifiers going down and the keys in ascending order. that is the order the player can
+    // send them in one report again
+    uint32_t time = timer_read32();
+    bool     idle = !mods;
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (recording && sent_keys[i] & ~keys[i] & (1 << bit)) {
+                record_event(i * 8 + bit, false, time);
+            }
+        }
+        idle = idle && !keys[i];
+    }
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        if (recording && sent_mods & ~mods & (1 << bit)) {
+            record_event(KC_LEFT_CTRL + bit, false, time);
+        }
+    }
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        if (recording && mods & ~sent_mods & (1 << bit)) {
+            record_event(KC_LEFT_CTRL + bit, true, time);
+        }
+    }
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (recording && keys[i] & ~sent_keys[i] & (1 << bit)) {
+                record_event(i * 8 + bit, true, time);
+            }
+        }
+    }
+    sent_mods = mods;
+    memcpy(sent_keys, keys, sizeof(sent_keys));
+    if (recording && idle) {
+        idle_end = length;
+    }
+}
+
+static void recorder_send_keyboard(report_keyboard_t *report) {
+    if (recording) {
+        uint8_t keys[NKRO_REPORT_BITS] = {0};
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            if (report->keys[i]) {
+                keys[report->keys[i] >> 3] |= 1 << (report->keys[i] & 7);
+            }
+        }
+        record_report(report->mods, keys);
+    }
+    host_driver->send_keyboard(report);
+}
+
+static void recorder_send_nkro(report_nkro_t *report) {
+    if (recording) {
+        record_report(report->mods, report->bits);
+    }
+    host_driver->send_nkro(report);
+}
+
+static bool read_event(macro_event_t *event) {
+    if (play.pos >= length) {
+        return false;
+    }
+    uint8_t token  = arena[play.pos++];
+    uint8_t code   = token & TOKEN_CODE;
+    event->pressed = token & TOKEN_PRESSED;
+    event->delay   = 0;
+    if (code == CODE_FULL) {
+        if (play.pos >= length) {
+            return false;
+        }
+        event->keycode = arena[play.pos++];
+        if (!IS_MODIFIER_KEYCODE(event->keycode)) {
+            play.prefix = event->keycode & PREFIX;
+        }
+    } else if (code >= CODE_MOD) {
+        event->keycode = KC_LEFT_CTRL + code - CODE_MOD;
+    } else {
+        event->keycode = play.prefix | code;
+    }
+    if (token & TOKEN_DELAY) {
+        uint8_t byte;
+        uint8_t shift = 0;
+        do {
+            if (play.pos >= length || shift > 14) {
+                return false;
+            }
+            byte = arena[play.pos++];
+            event->delay |= (uint16_t)(byte & ~VARINT_MORE) << shift;
+            shift += 7;
+        } while (byte & VARINT_MORE);
+        event->delay *= DELAY_TICK_MS;
+    }
+    return true;
+}
+
+// whether an event can go out in the same report as the ones before it: the host types the new keys of a report in
+// the order of their keycodes with nkro, and in no order it promises without, so only one key goes down per report
+// then. a key that changed already and a modifier after a key went down need a report of their own
+static bool joins_report(const macro_event_t *event, const uint8_t *changed, uint8_t last_pressed) {
+    if (changed[event->keycode >> 3] & (1 << (event->keycode & 7))) {
+        return false;
+    }
+    if (IS_MODIFIER_KEYCODE(event->keycode)) {
+        return !last_pressed;
+    }
+    return !event->pressed || !last_pressed || (host_can_send_nkro() && event->keycode > last_pressed);
+}
+
+static void play_end(void) {
+    // keys the recording still held go up and the mods the user held come back
+    play.paused = false;
+    clear_keys();
+    set_mods(play.mods);
+    send_keyboard_report();
+}
+
+static void play_run(void) {
+    uint8_t changed[NKRO_REPORT_BITS] = {0};
+    uint8_t last_pressed              = 0;
+    bool    resumed                   = play.paused;
+    play.paused                       = false;
+    if (!resumed && !read_event(&play.next)) {
+        play_end();
+        return;
+    }
+    do {
+        macro_event_t *event = &play.next;
+        if (event->delay >= MACRO_RECORDER_PAUSE_MS && !resumed) {
+            // the recording waited for the host here, e.g. for a dialog to open. the rest is played from
+            // macro_recorder_task
+            send_keyboard_report();
+            play.paused    = true;
+            play.paused_at = timer_read32();
+            return;
+        }
+        resumed = false;
+        if (!joins_report(event, changed, last_pressed)) {
+            send_keyboard_report();
+            memset(changed, 0, sizeof(changed));
+            last_pressed = 0;
+        }
+        if (IS_MODIFIER_KEYCODE(event->keycode)) {
+            if (event->pressed) {
+                add_mods(MOD_BIT(event->keycode));
+            } else {
+                del_mods(MOD_BIT(event->keycode));
+            }
+        } else if (event->pressed) {
+            add_key(event->keycode);
+            last_pressed = event->keycode;
+        } else {
+            del_key(event->keycode);
+        }
+        changed[event->keycode >> 3] |= 1 << (event->keycode & 7);
+    } while (read_event(&play.next));
+    play_end();
+}
+
+void macro_recorder_init(void) {
+#if MACRO_RECORDER_EEPROM_SIZE > 0
+    uint8_t size;
+    eeconfig_read_user_datablock(&size, USER_SETTINGS_SIZE, 1);
+    // a cleared eeprom reads 0, which is no macro
+    if (size < MACRO_RECORDER_EEPROM_SIZE && size <= sizeof(arena)) {
+        eeconfig_read_user_datablock(arena, USER_SETTINGS_SIZE + 1, size);
+        length = size;
+    }
+#endif
+}
+
+void macro_recorder_toggle(bool save) {
+    if (recording) {
+        recording = false;
+        length    = idle_end;
+        dprintf("macro: %u bytes\n", length);
+    } else if (!save) {
+        host_driver_t *driver = host_get_driver();
+        if (!driver) {
+            return;
+        }
+        if (driver != &recorder_driver) {
+            // the usb driver is only set after keyboard_post_init_user, so it is wrapped when it is first needed
+            host_driver                   = driver;
+            recorder_driver               = *driver;
+            recorder_driver.send_keyboard = recorder_send_keyboard;
+            recorder_driver.send_nkro     = recorder_send_nkro;
+            host_set_driver(&recorder_driver);
+        }
+        if (play.paused) {
+            play_end();
+        }
+        // a save that is still waiting for the keyboard to go idle would write the new recording half done
+        save_pending  = false;
+        recording     = true;
+        length        = 0;
+        idle_end      = 0;
+        record_prefix = 0;
+        sent_mods     = 0;
+        memset(sent_keys, 0, sizeof(sent_keys));
+        dprintf("macro: recording\n");
+    }
+#if MACRO_RECORDER_EEPROM_SIZE > 0
+    if (save) {
+        if (length < MACRO_RECORDER_EEPROM_SIZE) {
+            save_pending = true;
+        } else {
+            dprintf("macro: %u bytes do not fit the %u of the eeprom\n", length, MACRO_RECORDER_EEPROM_SIZE - 1);
+        }
+    }
+#endif
+}
+
+void macro_recorder_play(void) {
+    if (recording || play.paused) {
+        return;
+    }
+    play.pos    = 0;
+    play.prefix = 0;
+    play.mods   = get_mods();
+    // the macro sends its own mods, held and one shot ones would be added to every report
+    clear_mods();
+    clear_weak_mods();
+    clear_oneshot_mods();
+    play_run();
+}
+
+void macro_recorder_record(keyrecord_t *record) {
+    if (!play.paused) {
+        return;
+    }
+    if (record->event.pressed) {
+        // before the key changes the report
+        play_end();
+    } else {
+        // it may have been one of the mods held at the start, they are not brought back so it cannot stay stuck
+        play.mods = 0;
+    }
+}
+
+void macro_recorder_flush(void) {
+#if MACRO_RECORDER_EEPROM_SIZE > 0
+    if (!save_pending) {
+        return;
+    }
+    save_pending = false;
+    uint8_t size = length;
+    eeconfig_update_user_datablock(arena, USER_SETTINGS_SIZE + 1, size);
+    eeconfig_update_user_datablock(&size, USER_SETTINGS_SIZE, 1);
+    dprintf("macro: saved %u bytes\n", size);
+#endif
+}
+
+void macro_recorder_task(void) {
+    if (play.paused && timer_elapsed32(play.paused_at) >= play.next.delay) {
+        play_run();
+    }
+    if (save_pending && last_input_activity_elapsed() >= MACRO_RECORDER_SAVE_IDLE_MS) {
+        macro_recorder_flush();
+    }
+}
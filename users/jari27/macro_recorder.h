@@ -0,0 +1,43 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// records what the host is sent, every key and modifier going down or up, into a ram arena and plays it back. a
+// recording is cut back to the last moment nothing was held, so the keys held to stop it are not part of it
+
+#ifndef MACRO_RECORDER_SIZE
+#    define MACRO_RECORDER_SIZE 1024 // bytes of ram, 1 to 4 per key or modifier going down or up
+#endif
+// the saved macro lives behind the user settings in the eeconfig user datablock, a length byte and the recording
+#ifndef MACRO_RECORDER_EEPROM_SIZE
+#    define MACRO_RECORDER_EEPROM_SIZE 0
+#endif
+
+#ifdef MACRO_RECORDER_ENABLE
+// loads the saved macro, from keyboard_post_init_user
+void macro_recorder_init(void);
+
+// starts a recording, or stops the running one. with save it stops the running one or takes the last one, and writes
+// it to the eeprom once the keyboard is idle
+void macro_recorder_toggle(bool save);
+
+// plays the recording in as few reports as the host still types in the same order. gaps are left out, only pauses of
+// MACRO_RECORDER_PAUSE_MS and more are kept, and the rest of the playback waits for them in macro_recorder_task
+void macro_recorder_play(void);
+
+// a key going down ends a paused playback, from process_record_user
+void macro_recorder_record(keyrecord_t *record);
+
+// continues a paused playback and writes a pending save, from housekeeping_task_user
+void macro_recorder_task(void);
+
+// writes a pending save right away, e.g. before jumping to the bootloader
+void macro_recorder_flush(void);
+#else
+#    define macro_recorder_init()
+#    define macro_recorder_toggle(save)
+#    define macro_recorder_play()
+#    define macro_recorder_record(record)
+#    define macro_recorder_task()
+#    define macro_recorder_flush()
+#endif
@@ -0,0 +1,42 @@
+#include "nkro_send.h"
+
+// a packed string is the number of reports in two bytes, little endian, then for every report a byte with shift in
+// bit 7 and the key count below it, followed by the keycodes in ascending order. a report without keys releases them
+
+#define PACKED_SHIFT 0x80
+#define PACKED_COUNT 0x7F
+
+void nkro_send_packed(const uint8_t *packed) {
+    uint8_t  mods    = get_mods();
+    // a 6kro host reads the keys of a report in no set order, so without nkro every key gets a report of its own
+    uint8_t  limit   = host_can_send_nkro() ? PACKED_COUNT : 1;
+    uint16_t reports = pgm_read_byte(&packed[0]) | pgm_read_byte(&packed[1]) << 8;
+    packed += 2;
+    clear_weak_mods();
+    while (reports--) {
+        uint8_t header = pgm_read_byte(packed++);
+        uint8_t count  = header & PACKED_COUNT;
+        set_mods(header & PACKED_SHIFT ? MOD_BIT(KC_LSFT) : 0);
+        clear_keys();
+        for (uint8_t i = 0; i < count; i++) {
+            // the keys of a report are all different, so the next part can simply replace the previous one
+            if (i && i % limit == 0) {
+                send_keyboard_report();
+                clear_keys();
+            }
+            add_key(pgm_read_byte(packed++));
+        }
+        send_keyboard_report();
+    }
+    clear_keys();
+    set_mods(mods);
+    send_keyboard_report();
+}
+
+uint32_t nkro_string_check(const char *str) {
+    uint32_t check = 0x811C9DC5;
+    for (uint8_t c; (c = pgm_read_byte(str++));) {
+        check = (check ^ c) * 0x01000193;
+    }
+    return check;
+}
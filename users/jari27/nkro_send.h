@@ -0,0 +1,17 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// string macros packed into keyboard reports by tools/nkro_pack.py, which puts as many keys into a report as the host
+// still types in order. the packed strings are NAME_NKRO initializers in the git ignored nkro_strings.h of the keymap
+#if defined(NKRO_ENABLE) && __has_include("nkro_strings.h")
+#    include "nkro_strings.h"
+#endif
+
+// sends the reports of a packed string, a key at a time when the host is not using nkro. the mods held before are
+// restored afterwards
+void nkro_send_packed(const uint8_t *packed);
+
+// FNV-1a of a string in progmem, the same as NAME_NKRO_CHECK. a packed string is only sent when they match, so an
+// nkro_strings.h older than the string does not type the old one
+uint32_t nkro_string_check(const char *str);
@@ -0,0 +1,34 @@
+#include "oled_anim.h"
+#include "oled_sprite.h"
+
+// the changes of a frame are a span count, then line, x, length and the bytes of every span
+
+void oled_anim_start(oled_anim_state_t *state, const oled_anim_t *anim, uint8_t x, uint8_t line) {
+    *state = (oled_anim_state_t){.anim = anim, .drawn = timer_read32(), .x = x, .line = line};
+    oled_sprite_draw(anim->first, x, line);
+}
+
+bool oled_anim_task(oled_anim_state_t *state, uint16_t frame_ms) {
+    if (!state->anim || !is_oled_on() || timer_elapsed32(state->drawn) < frame_ms) {
+        return false;
+    }
+    uint16_t       stride = OLED_MATRIX_SIZE / oled_max_lines();
+    const uint8_t *delta  = state->anim->deltas + state->delta;
+    for (uint8_t spans = pgm_read_byte(delta++); spans; spans--) {
+        uint8_t  line   = pgm_read_byte(delta++);
+        uint8_t  x      = pgm_read_byte(delta++);
+        uint8_t  length = pgm_read_byte(delta++);
+        uint16_t index  = (state->line + line) * stride + state->x + x;
+        while (length--) {
+            oled_write_raw_byte(pgm_read_byte(delta++), index++);
+        }
+    }
+    if (++state->frame == state->anim->frames) {
+        state->frame = 0;
+        state->delta = 0;
+    } else {
+        state->delta = delta - state->anim->deltas;
+    }
+    state->drawn = timer_read32();
+    return true;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// animations packed by tools/sprite_pack.py: the first frame is a sprite, every later frame only the buffer bytes that
+// changed. a frame costs as many oled_write_raw_byte calls as it changes bytes, and the driver only sends the blocks
+// those bytes are in, so the work per frame is fixed when the art is packed. oled_art.h lists the worst frame of each
+
+typedef struct {
+    const uint8_t *first;  // sprite of the first frame
+    const uint8_t *deltas; // changes from each frame to the next, the last frame's lead back to the first
+    uint8_t        frames;
+} oled_anim_t;
+
+typedef struct {
+    const oled_anim_t *anim;
+    uint32_t           drawn; // when the current frame was drawn
+    uint16_t           delta; // where the changes to the next frame start
+    uint8_t            frame;
+    uint8_t            x;
+    uint8_t            line;
+} oled_anim_state_t;
+
+// draws the first frame with the image's top left corner at pixel x of line
+void oled_anim_start(oled_anim_state_t *state, const oled_anim_t *anim, uint8_t x, uint8_t line);
+
+// draws the next frame once frame_ms passed since the current one, returns true if it did. nothing is drawn while the
+// display is off, a write would turn it on again
+bool oled_anim_task(oled_anim_state_t *state, uint16_t frame_ms);
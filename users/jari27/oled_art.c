@@ -0,0 +1,63 @@
+#include "oled_art.h"
+
+// generated by tools/sprite_pack.py from users/jari27/art, do not edit
+
+// clang-format off
+
+const uint8_t art_apple[] PROGMEM = {
+    10, 0, 11, 2,
+    0x57, 0x89, 0x7a, 0x6b, 0x6a, 0x32, 0x1a, 0x23, 0x1a, 0x13, 0x1b, 0x12, 0x2a, 0x63, 0x24, 0x81,
+    0x42, 0x40,
+};
+
+const uint8_t art_aurora[] PROGMEM = {
+    0, 0, 32, 16,
+    0xf7, 0x36, 0xfa, 0x8f, 0xdc, 0x8c, 0x1f, 0xb1, 0xc1, 0x61, 0x13, 0xf4, 0x13, 0xa2, 0x1e, 0x6f,
+    0x54, 0xff, 0x0f, 0x77, 0x31, 0xfb, 0x63, 0xa1, 0xe1, 0x81, 0xfe, 0x14, 0x3f, 0x91, 0x37, 0x81,
+    0x63, 0xa1, 0x21, 0xd1, 0x14, 0xd1, 0xbf, 0x97, 0xf9, 0xa2, 0x71, 0x23, 0x21, 0x23, 0x21, 0x31,
+    0x32, 0xff, 0xa2, 0x32, 0xf3, 0x14, 0xf4, 0x64, 0x11, 0x23, 0x54, 0x32, 0x31, 0x31, 0xfe, 0xf9,
+    0x75, 0x1e, 0x41, 0xd5, 0x26, 0x22, 0x22, 0x11, 0x46, 0xff, 0x32, 0x12, 0xf7, 0xf3, 0xf5, 0x62,
+    0x11, 0x21, 0x11, 0x23, 0x14, 0x2f, 0x9f, 0xc1, 0xf9, 0xff, 0x17, 0x92, 0x15, 0xfe, 0x12, 0x4f,
+    0x42, 0x3f, 0x96, 0x12, 0x5d, 0x46, 0x3f, 0xcf, 0x47, 0xfa, 0x11, 0xf0, 0x99, 0x44, 0x16, 0x16,
+    0x1f, 0x9a, 0xf4, 0xf0, 0xe1, 0x22, 0x24, 0x84, 0x71, 0xd3, 0xf0, 0x8f, 0xbe, 0x39, 0xc3, 0x64,
+    0xb1, 0xe1, 0x51, 0xf3, 0x91, 0x14, 0xfd, 0xf0, 0x84, 0x39, 0x15, 0x2f, 0xff, 0xf0, 0x13, 0xef,
+    0x54, 0x22, 0x54, 0x11, 0x22, 0x11, 0x21, 0xfb, 0x17, 0xb1, 0x1c, 0x31, 0xf7, 0x11, 0x7f, 0x17,
+    0x41, 0x11, 0x22, 0x1f, 0x93, 0xf8, 0xf7, 0xf9, 0x8f, 0x14, 0x32, 0xf9, 0x1f, 0xf0, 0x13, 0xf3,
+    0xf0, 0xf3, 0xc6, 0xff, 0xf4, 0xf5, 0x22, 0x27, 0xc4, 0x31, 0x21, 0xf2, 0x7f, 0xff, 0x81, 0x1a,
+    0xf6, 0xf4, 0xc4, 0xff, 0xe1, 0x9f, 0x71, 0x6d, 0xce, 0x27, 0x1f, 0xff, 0x23, 0x79, 0xf6, 0xcf,
+    0x64, 0x11, 0x12, 0xc1, 0xff, 0x9f, 0x5f, 0x12, 0x39, 0xf6, 0x31, 0x3f, 0xf1, 0x1b, 0x21, 0x33,
+    0xdf, 0x89, 0xf8, 0x5f, 0x71, 0xfa, 0xf0, 0xf7, 0xbf, 0x66, 0xff, 0xfe, 0xf2, 0x87, 0x3d, 0x41,
+    0x46, 0xff, 0xf6, 0x12, 0x31, 0xf0, 0xf9, 0x9a, 0x22, 0x2c, 0x12, 0x13, 0x1f, 0xff, 0x3f, 0x0f,
+    0x1f, 0x06, 0x62, 0x72, 0x12, 0x21, 0x13, 0x1d, 0x1f, 0x7f, 0x2f, 0x29, 0x34, 0xf0, 0x4a, 0x62,
+    0x11, 0x2f, 0xa1, 0xf5, 0xf1, 0xf0, 0xe8, 0x9c, 0x8f, 0x93, 0xf0, 0x9d, 0xd2, 0xf0, 0x73, 0xf6,
+    0x3f, 0xa1, 0xb9, 0x19, 0xee, 0x31, 0xba, 0xfe,
+};
+
+const uint8_t art_linux[] PROGMEM = {
+    10, 0, 11, 2,
+    0xc2, 0x93, 0x14, 0x79, 0x63, 0x34, 0x26, 0x52, 0x22, 0x12, 0x11, 0x61, 0x24, 0x21, 0x61, 0x22,
+    0x12, 0x11, 0x52, 0x37, 0x34, 0x79, 0x92, 0x13, 0x20,
+};
+
+const uint8_t art_windows[] PROGMEM = {
+    10, 0, 11, 2,
+    0x25, 0x15, 0x55, 0x15, 0x55, 0x15, 0x46, 0x16, 0xf4, 0x61, 0x63, 0x61, 0x63, 0x61, 0x62, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71,
+};
+
+static const uint8_t anim_aurora_deltas[] PROGMEM = {
+    0x05, 0x00, 0x0b, 0x03, 0x00, 0x08, 0x00, 0x00, 0x15, 0x03, 0x02, 0x07, 0x02, 0x01, 0x0c, 0x03,
+    0x02, 0x07, 0x02, 0x02, 0x16, 0x03, 0x40, 0xe0, 0x40, 0x04, 0x0e, 0x03, 0x04, 0x0f, 0x84, 0x08,
+    0x00, 0x02, 0x03, 0x10, 0x38, 0x10, 0x00, 0x0b, 0x03, 0x08, 0x1c, 0x08, 0x00, 0x15, 0x03, 0x00,
+    0x02, 0x00, 0x01, 0x0c, 0x06, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x01, 0x17, 0x03, 0x04, 0x0e,
+    0x04, 0x02, 0x16, 0x03, 0x00, 0x40, 0x00, 0x03, 0x13, 0x03, 0x10, 0x38, 0x10, 0x04, 0x0c, 0x05,
+    0x40, 0xff, 0x40, 0x05, 0x80, 0x08, 0x00, 0x02, 0x03, 0x00, 0x10, 0x00, 0x00, 0x1b, 0x03, 0x10,
+    0x38, 0x10, 0x01, 0x03, 0x03, 0x20, 0x70, 0x20, 0x01, 0x0f, 0x03, 0x40, 0xe0, 0x40, 0x01, 0x17,
+    0x09, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x02, 0x1e, 0x01, 0x00, 0x03, 0x13,
+    0x09, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0xb8, 0x10, 0x04, 0x0c, 0x03, 0x00, 0x5f, 0x00,
+    0x05, 0x00, 0x1b, 0x03, 0x00, 0x10, 0x00, 0x01, 0x03, 0x03, 0x00, 0x20, 0x00, 0x01, 0x1d, 0x03,
+    0x80, 0xc0, 0x80, 0x02, 0x1e, 0x01, 0x01, 0x03, 0x19, 0x03, 0x00, 0x90, 0x00,
+};
+
+const oled_anim_t anim_aurora = {art_aurora, anim_aurora_deltas, 4};
+// clang-format on
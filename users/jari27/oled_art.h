@@ -0,0 +1,13 @@
+#pragma once
+
+#include "oled_anim.h"
+
+// generated by tools/sprite_pack.py from users/jari27/art, do not edit. sprites are drawn with
+// oled_sprite_draw and animations played with oled_anim_task
+
+extern const uint8_t art_apple[] PROGMEM; // 32x16, 22 bytes instead of 64
+extern const uint8_t art_aurora[] PROGMEM; // 32x128, 300 bytes instead of 512
+extern const uint8_t art_linux[] PROGMEM; // 32x16, 29 bytes instead of 64
+extern const uint8_t art_windows[] PROGMEM; // 32x16, 25 bytes instead of 64
+
+extern const oled_anim_t anim_aurora; // 4 frames, 173 bytes of changes, each frame at most 34 bytes on 5 lines
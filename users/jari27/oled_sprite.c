@@ -0,0 +1,39 @@
+#include "oled_sprite.h"
+
+// a sprite is x, line, width and lines of its box, then runs of unlit and lit pixels in turns, column by column from
+// the top, one nibble per run and high nibble first. a nibble of 15 goes on in the next one instead of ending the run
+
+#define CONTINUE 15
+
+void oled_sprite_draw(const uint8_t *sprite, uint8_t x, uint8_t line) {
+    uint8_t  left   = x + pgm_read_byte(&sprite[0]);
+    uint8_t  top    = line + pgm_read_byte(&sprite[1]);
+    uint8_t  width  = pgm_read_byte(&sprite[2]);
+    uint8_t  lines  = pgm_read_byte(&sprite[3]);
+    uint16_t stride = OLED_MATRIX_SIZE / oled_max_lines(); // bytes per line of the buffer in the current rotation
+    const uint8_t *runs = sprite + 4;
+
+    uint16_t nibble = 0;
+    uint8_t  run    = 0;
+    uint8_t  colour = 0;
+    bool     toggle = false;
+    for (uint8_t col = 0; col < width; col++) {
+        for (uint8_t page = 0; page < lines; page++) {
+            uint8_t byte = 0;
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                while (!run) {
+                    if (toggle) {
+                        colour ^= 1;
+                    }
+                    uint8_t packed = pgm_read_byte(&runs[nibble / 2]);
+                    run            = nibble % 2 ? packed & 0x0F : packed >> 4;
+                    toggle         = run != CONTINUE;
+                    nibble++;
+                }
+                byte |= colour << bit;
+                run--;
+            }
+            oled_write_raw_byte(byte, (top + page) * stride + left + col);
+        }
+    }
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// art compressed by tools/sprite_pack.py from the images in users/jari27/art, see oled_art.h for the sprites. about
+// half the flash of the raw column bytes, and the art is edited as an image instead of as hex
+
+// draws the sprite with its image's top left corner at pixel x of line, straight into the oled buffer. only the box
+// around the lit pixels of the image is written, what is around it is left as it is
+void oled_sprite_draw(const uint8_t *sprite, uint8_t x, uint8_t line);
@@ -0,0 +1,103 @@
+#include "oled_widgets.h"
+#include "profiler.h"
+
+// the oled driver only sends blocks that changed, but rendering every widget on every update still costs scan time.
+// keeping track of the inputs means an update where nothing changed does not touch the buffer at all.
+
+extern os_variant_t selected_os;
+
+typedef struct {
+    uint8_t mods;
+    uint8_t oneshot_mods;
+    uint8_t os;
+    uint8_t layer;
+    uint8_t default_layer;
+} oled_inputs_t;
+
+static oled_inputs_t last;
+static bool          drawn;
+static uint16_t      pending; // widgets by index whose inputs changed and that were not drawn again yet
+static uint8_t       current_line;
+
+static uint8_t oled_inputs_changed(void) {
+    oled_inputs_t now = {
+        .mods          = get_mods(),
+        .oneshot_mods  = get_oneshot_mods(),
+        .os            = selected_os,
+        .layer         = get_highest_layer(layer_state | default_layer_state),
+        .default_layer = get_highest_layer(default_layer_state),
+    };
+    uint8_t changed = 0;
+    if (now.mods != last.mods) changed |= OLED_IN_MODS;
+    if (now.oneshot_mods != last.oneshot_mods) changed |= OLED_IN_ONESHOT_MODS;
+    if (now.os != last.os) changed |= OLED_IN_OS;
+    if (now.layer != last.layer) changed |= OLED_IN_LAYER;
+    if (now.default_layer != last.default_layer) changed |= OLED_IN_DEFAULT_LAYER;
+    last = now;
+    return changed;
+}
+
+bool oled_widgets_render(const oled_widget_t *widgets, uint8_t count, uint8_t budget) {
+    uint8_t changed = oled_inputs_changed();
+    if (!drawn || changed) {
+        for (uint8_t i = 0; i < count; i++) {
+            if (!drawn || (widgets[i].inputs & changed)) {
+                pending |= 1U << i;
+            }
+        }
+        drawn = true;
+    }
+    if (!pending) {
+        return false;
+    }
+    for (uint8_t i = 0; i < count && budget; i++) {
+        if (pending & (1U << i)) {
+            pending &= ~(1U << i);
+            budget--;
+            current_line = widgets[i].line;
+            oled_set_cursor(0, current_line);
+            profiler_widget_enter();
+            widgets[i].render();
+            profiler_widget_exit(i);
+        }
+    }
+    return true;
+}
+
+uint8_t oled_widget_line(void) {
+    return current_line;
+}
+
+void oled_widgets_invalidate(void) {
+    drawn = false;
+}
+
+#ifdef OLED_FONT_SUBSET
+#    include "glcdfont_subset.h"
+
+// where each character below the tiles is in the subset font, one table read per character and still a direct index
+// in the driver. characters the font does not have become a space, which is below OLED_FONT_START and drawn blank
+static const char PROGMEM text_map[] = FONT_SUBSET_TEXT_MAP;
+
+static inline char text_glyph(char c) {
+    return (uint8_t)c < sizeof(text_map) - 1 ? pgm_read_byte(&text_map[(uint8_t)c]) : c;
+}
+
+void oled_write_text(const char *text) {
+    for (; *text; text++) {
+        oled_write_char(text_glyph(*text), false);
+    }
+}
+
+void oled_write_text_P(const char *text) {
+    for (char c; (c = pgm_read_byte(text)); text++) {
+        oled_write_char(text_glyph(c), false);
+    }
+}
+#endif
+
+void oled_render_number(uint8_t value) {
+    // always three digits, written directly instead of through sprintf
+    char str[] = {'0' + value / 100, '0' + value / 10 % 10, '0' + value % 10, 0};
+    oled_write_text(str);
+}
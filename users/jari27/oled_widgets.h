@@ -0,0 +1,42 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// what a widget is drawn from, it is only redrawn when one of these changed
+enum oled_widget_input {
+    OLED_IN_MODS          = 1 << 0,
+    OLED_IN_ONESHOT_MODS  = 1 << 1,
+    OLED_IN_OS            = 1 << 2,
+    OLED_IN_LAYER         = 1 << 3, // highest layer including the default layer
+    OLED_IN_DEFAULT_LAYER = 1 << 4,
+};
+
+// one per line at most, so 16 on a 128x32 screen
+typedef struct {
+    uint8_t line;   // widgets draw from column 0 of this line onwards
+    uint8_t inputs; // oled_widget_input bits, 0 for static content that is only drawn once
+    void (*render)(void);
+} oled_widget_t;
+
+// redraws the widgets whose inputs changed since they were last drawn, at most budget of them in the order of the table
+// and the rest on the next calls. returns true if anything was drawn
+bool oled_widgets_render(const oled_widget_t *widgets, uint8_t count, uint8_t budget);
+
+// the line of the widget being drawn, for widgets that draw to buffer positions instead of at the cursor
+uint8_t oled_widget_line(void);
+
+// draws every widget again on the next call, for when the display buffer was cleared
+void oled_widgets_invalidate(void);
+
+// a byte as three digits with leading zeros
+void oled_render_number(uint8_t value);
+
+// text for the screens. with OLED_FONT_SUBSET the font only has the characters tools/font_subset.py found in the render
+// functions, at other places, so every text write has to go through these. tiles from 0x80 up are written as they are
+#ifdef OLED_FONT_SUBSET
+void oled_write_text(const char *text);
+void oled_write_text_P(const char *text);
+#else
+#    define oled_write_text(text) oled_write(text, false)
+#    define oled_write_text_P(text) oled_write_P(text, false)
+#endif
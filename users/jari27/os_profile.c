@@ -0,0 +1,78 @@
+#include "os_profile.h"
+
+os_variant_t        selected_os = OS_UNSURE;
+const os_profile_t *os_profile  = os_profiles;
+
+static uint16_t held_shortcuts[OS_SHORTCUT_COUNT];
+static uint8_t  held_counts[OS_SHORTCUT_COUNT]; // the keymap's clipboard keys and the CS_ ones can hold the same one
+static uint16_t pressed_as[MATRIX_ROWS][MATRIX_COLS];
+
+void os_profile_select(os_variant_t os) {
+    if (os == OS_IOS) {
+        os = OS_MACOS;
+    }
+    os_profile = os_profiles;
+    for (uint8_t i = 0; i < os_profile_count; i++) {
+        if (os_profiles[i].os == os) {
+            os_profile = &os_profiles[i];
+            break;
+        }
+    }
+    selected_os = os_profile->os;
+}
+
+void os_profile_next(void) {
+    uint8_t next = os_profile - os_profiles + 1;
+    os_profile   = &os_profiles[next < os_profile_count ? next : 0];
+    selected_os  = os_profile->os;
+}
+
+static uint16_t os_profile_lookup(uint16_t keycode) {
+    if (!os_profile->remaps) {
+        return keycode;
+    }
+    const os_remap_t *remap = &os_profile->remaps[OS_REMAP_SLOT(keycode)];
+    return remap->from == keycode ? remap->to : keycode;
+}
+
+uint16_t os_profile_remap(uint16_t keycode, keyrecord_t *record) {
+    keypos_t key = record->event.key;
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        // a combo has no place in the matrix, its release is looked up again
+        return os_profile_lookup(keycode);
+    }
+    if (record->event.pressed) {
+        pressed_as[key.row][key.col] = os_profile_lookup(keycode);
+        return pressed_as[key.row][key.col];
+    }
+    uint16_t remapped            = pressed_as[key.row][key.col];
+    pressed_as[key.row][key.col] = KC_NO;
+    return remapped != KC_NO ? remapped : os_profile_lookup(keycode);
+}
+
+// the mods of a chord as real mods, QMK drops the weak ones register_code16 would use at the next key press
+static uint8_t os_shortcut_mods(uint16_t chord) {
+    uint8_t mods = QK_MODS_GET_MODS(chord);
+    return mods & 0x10 ? (mods & 0x0F) << 4 : mods; // right hand mods have bit 4 set for all of them
+}
+
+void os_shortcut_hold(enum os_shortcut shortcut, bool pressed) {
+    uint16_t chord = held_shortcuts[shortcut];
+    if (pressed) {
+        if (held_counts[shortcut]++) {
+            // a second key with the same shortcut presses it again, like a second tap
+            unregister_code(QK_MODS_GET_BASIC_KEYCODE(chord));
+            register_code(QK_MODS_GET_BASIC_KEYCODE(chord));
+            return;
+        }
+        chord                    = os_shortcut(shortcut);
+        held_shortcuts[shortcut] = chord;
+        register_mods(os_shortcut_mods(chord));
+        register_code(QK_MODS_GET_BASIC_KEYCODE(chord));
+    } else if (held_counts[shortcut] && !--held_counts[shortcut]) {
+        // only the last key up releases the chord
+        unregister_code(QK_MODS_GET_BASIC_KEYCODE(chord));
+        unregister_mods(os_shortcut_mods(chord));
+        held_shortcuts[shortcut] = KC_NO;
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// chords that differ per os, sent with tap_code16(os_shortcut(...)) or held with os_shortcut_hold
+enum os_shortcut {
+    OS_UNDO,
+    OS_REDO,
+    OS_CUT,
+    OS_COPY,
+    OS_PASTE,
+    OS_SELECT_ALL,
+    OS_WORD_LEFT,
+    OS_WORD_RIGHT,
+    OS_LINE_START,
+    OS_LINE_END,
+    OS_SHORTCUT_COUNT,
+};
+
+typedef struct {
+    uint16_t from;
+    uint16_t to;
+} os_remap_t;
+
+// a remap table has a slot for every key it remaps, worked out from the keycode, so a key press only looks at one entry.
+// fill it with OS_REMAP, two keys that end up in the same slot override each other, which gcc warns about with
+// -Woverride-init and the keymap sim builds with
+#define OS_REMAP_SLOTS 16
+#define OS_REMAP_SLOT(keycode) ((uint8_t)((keycode) ^ (keycode) >> 8) % OS_REMAP_SLOTS)
+#define OS_REMAP(from, to) [OS_REMAP_SLOT(from)] = {(from), (to)}
+
+typedef struct {
+    os_variant_t      os;
+    hsv_t             color;
+    uint8_t           guard_mods;  // KC_Q and KC_H do nothing while these are held, against cmd+q/h on macos
+    const os_remap_t *remaps;      // OS_REMAP_SLOTS keys that are processed as another key on this os, or NULL
+    const uint16_t   *shortcuts;   // OS_SHORTCUT_COUNT chords
+} os_profile_t;
+
+// defined in jari27.c, CS_SWAP_OS cycles through them in order and the first one is used when the os is unknown
+extern const os_profile_t os_profiles[];
+extern const uint8_t      os_profile_count;
+
+// defined in keymap.c with OS_REMAP, the keys that are processed as another key outside of macos
+extern const os_remap_t pc_remaps[OS_REMAP_SLOTS];
+
+extern os_variant_t        selected_os;
+extern const os_profile_t *os_profile;
+
+// only called when the os is detected or swapped, keypresses just read the active profile
+void os_profile_select(os_variant_t os);
+void os_profile_next(void);
+
+// the keycode to process instead of keycode on the current os, or keycode itself. a key lets go of what it was remapped
+// to when it went down, so keys held while the os changes are released right and the real mods stay down
+uint16_t os_profile_remap(uint16_t keycode, keyrecord_t *record);
+
+static inline uint16_t os_shortcut(enum os_shortcut shortcut) {
+    return os_profile->shortcuts[shortcut];
+}
+
+// registers the chord while the key is down, so the host autorepeats it like a normal key. the release lets go of the
+// chord that was registered, also when the os changed in between. two keys can hold the same shortcut, the second press
+// sends it again and the chord stays down until the last of them is released
+void os_shortcut_hold(enum os_shortcut shortcut, bool pressed);
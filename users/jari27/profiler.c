@@ -0,0 +1,208 @@
+#include "profiler.h"
+#include "oled_widgets.h"
+#include "timer_us.h"
+
+// the matrix code selects and reads one line after the other, a row per line with COL2ROW diodes and a column with
+// ROW2COL, and the last one ends the matrix section
+#ifdef SPLIT_KEYBOARD
+#    define PROFILER_ROWS (MATRIX_ROWS / 2)
+#else
+#    define PROFILER_ROWS MATRIX_ROWS
+#endif
+#if defined(DIODE_DIRECTION) && DIODE_DIRECTION == ROW2COL
+#    define PROFILER_LAST_LINE (MATRIX_COLS - 1)
+#else
+#    define PROFILER_LAST_LINE (PROFILER_ROWS - 1)
+#endif
+
+typedef struct {
+    uint32_t us[PROFILER_SECTION_COUNT];
+    uint32_t max_us[PROFILER_SECTION_COUNT]; // longest single stretch, e.g. one oled update
+    uint32_t widget_us[PROFILER_WIDGETS];
+    uint16_t widget_calls[PROFILER_WIDGETS];
+    uint32_t loops;
+    uint32_t loop_min_us;
+    uint32_t loop_max_us;
+    uint32_t window_us;
+} profiler_window_t;
+
+static profiler_window_t window; // being counted
+static profiler_window_t last;   // the last full one, loops is 0 until there is one
+
+static uint8_t  section = PROFILER_CORE;
+static uint32_t section_start;
+static uint32_t loop_start;
+static uint32_t window_start;
+static uint32_t widget_start;
+static uint32_t worst_loop_us; // since the last reset
+static bool     running;
+static bool     oled_shown;
+static bool     oled_stale;
+
+static void profiler_charge(uint32_t now) {
+    uint32_t us = now - section_start;
+    window.us[section] += us;
+    if (us > window.max_us[section]) {
+        window.max_us[section] = us;
+    }
+    section_start = now;
+}
+
+void profiler_mark(uint8_t next) {
+    profiler_charge(timer_us_now());
+    section = next;
+}
+
+uint8_t profiler_enter(uint8_t next) {
+    uint8_t previous = section;
+    profiler_mark(next);
+    return previous;
+}
+
+void profiler_loop(void) {
+    uint32_t now = timer_us_now();
+    if (!running) {
+        // the first loop after boot or a reset has no start
+        memset(&window, 0, sizeof(window));
+        running       = true;
+        section_start = now;
+        loop_start    = now;
+        window_start  = now;
+        section       = PROFILER_HOUSEKEEPING;
+        return;
+    }
+    profiler_charge(now);
+    section = PROFILER_HOUSEKEEPING;
+
+    uint32_t loop_us = now - loop_start;
+    loop_start       = now;
+    if (!window.loops || loop_us < window.loop_min_us) {
+        window.loop_min_us = loop_us;
+    }
+    if (loop_us > window.loop_max_us) {
+        window.loop_max_us = loop_us;
+    }
+    if (loop_us > worst_loop_us) {
+        worst_loop_us = loop_us;
+    }
+    window.loops++;
+
+    if (now - window_start >= (uint32_t)PROFILER_WINDOW_MS * 1000) {
+        window.window_us = now - window_start;
+        last             = window;
+        memset(&window, 0, sizeof(window));
+        window_start = now;
+        oled_stale   = true;
+    }
+}
+
+// the matrix code's delays after selecting and after unselecting a line, weak in QMK's matrix_common.c
+void matrix_output_select_delay(void) {
+    if (section != PROFILER_MATRIX) {
+        profiler_mark(PROFILER_MATRIX);
+    }
+    waitInputPinDelay();
+}
+
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {
+    matrix_io_delay();
+    if (line == PROFILER_LAST_LINE) {
+        profiler_mark(PROFILER_SPLIT);
+    }
+}
+
+void profiler_widget_enter(void) {
+    widget_start = timer_us_now();
+}
+
+void profiler_widget_exit(uint8_t index) {
+    if (index < PROFILER_WIDGETS) {
+        window.widget_us[index] += timer_us_now() - widget_start;
+        window.widget_calls[index]++;
+    }
+}
+
+void profiler_toggle_oled(void) {
+    oled_shown = !oled_shown;
+    oled_stale = true;
+}
+
+bool profiler_oled_shown(void) {
+    return oled_shown;
+}
+
+static uint32_t profiler_pct(uint32_t us) {
+    return last.window_us ? us * 100 / last.window_us : 0;
+}
+
+#ifdef OLED_ENABLE
+static void render_profiler_value(uint32_t value, uint8_t width) {
+    // right aligned and all nines when it does not fit, written directly instead of through sprintf
+    char    str[] = "     ";
+    uint8_t i     = width;
+    do {
+        str[--i] = '0' + value % 10;
+        value /= 10;
+    } while (value && i);
+    if (value) {
+        memset(str, '9', width);
+    }
+    str[width] = 0;
+    oled_write_text(str);
+}
+
+void profiler_render(void) {
+    // only a new window changes it, every line is exactly 5 characters
+    static const char PROGMEM tags[PROFILER_SECTION_COUNT][4] = {"usb", "mtx", "spl", "cor", "rec", "rgb", "old", "hk "};
+    if (!oled_stale) {
+        return;
+    }
+    oled_stale = false;
+    oled_set_cursor(0, 0);
+    // loop time min, avg and max in us, then loops per second
+    oled_write_text_P(PSTR("loop "));
+    render_profiler_value(last.loops ? last.loop_min_us : 0, 5);
+    render_profiler_value(last.loops ? last.window_us / last.loops : 0, 5);
+    render_profiler_value(last.loop_max_us, 5);
+    oled_write_text_P(PSTR("hz   "));
+    render_profiler_value(last.window_us ? (uint64_t)last.loops * 1000000 / last.window_us : 0, 5);
+    oled_write_text_P(PSTR("     "));
+    for (uint8_t i = 0; i < PROFILER_SECTION_COUNT; i++) {
+        oled_write_text_P(tags[i]);
+        render_profiler_value(profiler_pct(last.us[i]), 2);
+    }
+}
+#endif
+
+void profiler_print(void) {
+    static const char *const names[PROFILER_SECTION_COUNT] = {"usb",    "matrix", "split", "core",
+                                                               "record", "rgb",    "oled",  "housekeeping"};
+    if (!last.loops) {
+        uprintf("profile: no full window yet\n");
+        return;
+    }
+    uprintf("profile: %lu loops in %lu ms, %lu loops/s\n", (unsigned long)last.loops,
+            (unsigned long)(last.window_us / 1000), (unsigned long)((uint64_t)last.loops * 1000000 / last.window_us));
+    uprintf("loop (us)         min      avg      max    worst\n");
+    uprintf("%21lu %8lu %8lu %8lu\n", (unsigned long)last.loop_min_us, (unsigned long)(last.window_us / last.loops),
+            (unsigned long)last.loop_max_us, (unsigned long)worst_loop_us);
+    uprintf("section             us    %%   max us\n");
+    for (uint8_t i = 0; i < PROFILER_SECTION_COUNT; i++) {
+        uprintf("%-12s %9lu %4lu %8lu\n", names[i], (unsigned long)last.us[i], (unsigned long)profiler_pct(last.us[i]),
+                (unsigned long)last.max_us[i]);
+    }
+    // the widgets are the master screen in the order of oled_master_widgets, part of the oled section
+    for (uint8_t i = 0; i < PROFILER_WIDGETS; i++) {
+        if (last.widget_calls[i]) {
+            uprintf("widget %-5u %9lu %4lu calls %u\n", i, (unsigned long)last.widget_us[i],
+                    (unsigned long)profiler_pct(last.widget_us[i]), last.widget_calls[i]);
+        }
+    }
+}
+
+void profiler_reset(void) {
+    memset(&last, 0, sizeof(last));
+    worst_loop_us = 0;
+    running       = false;
+    oled_stale    = true;
+}
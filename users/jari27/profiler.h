@@ -0,0 +1,72 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// where the main loop spends its time. every loop is split into sections at the hooks QMK calls in a fixed order, the
+// time between two marks goes to the section the first one started, so the sections add up to the whole loop:
+// usb          - housekeeping_task_user returning until the first matrix row, the usb work of protocol_pre_task
+// matrix       - reading the rows of this half
+// split        - the last row until matrix_scan_user: debounce, the split transport and the split sync rpc
+// core         - everything QMK does that is not marked: key events, tap-hold, combos, sending reports, the rgb flush,
+//                the oled driver sending the buffer and protocol_post_task
+// record       - process_record_user
+// rgb          - the custom effects and rgb_matrix_indicators_advanced_user
+// oled         - oled_task_user, and each master widget on its own besides
+// housekeeping - housekeeping_task_user without the split sync
+// usb interrupts are counted in whatever section they interrupt. times are in microseconds, over windows of
+// PROFILER_WINDOW_MS, the last full window is what is shown
+enum profiler_section {
+    PROFILER_USB = 0,
+    PROFILER_MATRIX,
+    PROFILER_SPLIT,
+    PROFILER_CORE,
+    PROFILER_RECORD,
+    PROFILER_RGB,
+    PROFILER_OLED,
+    PROFILER_HOUSEKEEPING,
+    PROFILER_SECTION_COUNT,
+};
+
+#ifndef PROFILER_WINDOW_MS
+#    define PROFILER_WINDOW_MS 1000
+#endif
+#define PROFILER_WIDGETS 16 // one per oled line at most
+
+#ifdef PROFILER_ENABLE
+// the time since the last mark goes to the current section and section takes over
+void profiler_mark(uint8_t section);
+
+// the same, returns the section it replaced for a profiler_mark at the end of a hook that can run anywhere
+uint8_t profiler_enter(uint8_t section);
+
+// the end of a loop, from the start of housekeeping_task_user
+void profiler_loop(void);
+
+// around the render function of a master widget, the index in oled_master_widgets
+void profiler_widget_enter(void);
+void profiler_widget_exit(uint8_t index);
+
+// toggles the profile on the master oled instead of the widgets, true while it is shown
+void profiler_toggle_oled(void);
+bool profiler_oled_shown(void);
+
+// the last window on the master oled, 16 lines of 5 characters
+void profiler_render(void);
+
+void profiler_print(void);
+void profiler_reset(void);
+#else
+// functions, so the section profiler_enter returned is still used
+static inline void profiler_mark(uint8_t section) {}
+static inline uint8_t profiler_enter(uint8_t section) {
+    return 0;
+}
+#    define profiler_loop()
+#    define profiler_widget_enter()
+#    define profiler_widget_exit(index)
+#    define profiler_toggle_oled()
+#    define profiler_oled_shown() false
+#    define profiler_render()
+#    define profiler_print()
+#    define profiler_reset()
+#endif
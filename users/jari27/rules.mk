@@ -0,0 +1,110 @@
+# shared by every jari27 keymap, included by QMK after the keymap's rules.mk. the keymap's rules.mk picks the QMK
+# features, what is built here follows from them so a build only links what it uses
+
+# process_record_user and the other _user hooks, os profiles and the shifted symbols
+SRC += jari27.c
+
+# OS detection
+SRC += os_profile.c
+
+# os override, brightness, default layer and tapping terms, kept across reboots
+SRC += user_settings.c tapping_learn.c
+
+# layers, wpm and os sent to the slave only when they changed
+SRC += split_sync.c
+
+# typing speed, backspace ratio and layer usage, on the slave oled and printed with CS_TYPS
+SRC += typing_stats.c
+
+# the generated files below are made before any object through QMK's generated-files target, and only when what they
+# are generated from changed. the generators only write a file when its content changed, so the touch keeps make from
+# running them again
+JARI27_TOOLS := $(USER_PATH)/../../tools
+
+# string macros sent as packed nkro reports, see tools/nkro_pack.py. the packed strings are written next to the
+# keymap's secrets.h and are made again whenever one of its headers changes
+NKRO_STRINGS ?= YUBIKEY_CODE
+ifeq ($(strip $(NKRO_ENABLE)), yes)
+    SRC += nkro_send.c
+    NKRO_STRINGS_H := $(KEYMAP_PATH)/nkro_strings.h
+    NKRO_STRINGS_SOURCES := $(filter-out $(NKRO_STRINGS_H),$(wildcard $(KEYMAP_PATH)/*.h))
+generated-files: $(NKRO_STRINGS_H)
+$(NKRO_STRINGS_H): $(NKRO_STRINGS_SOURCES) $(JARI27_TOOLS)/nkro_pack.py
+	python3 $(JARI27_TOOLS)/nkro_pack.py --out $@ $(NKRO_STRINGS_SOURCES) $(NKRO_STRINGS)
+	touch $@
+endif
+
+# master status screen widgets and the animated slave art, with the font that has the mod and os icons. the art is
+# packed from the images in art/, see tools/sprite_pack.py
+ifeq ($(strip $(OLED_ENABLE)), yes)
+    SRC += oled_widgets.c oled_sprite.c oled_anim.c oled_art.c jari27_oled.c
+generated-files: $(USER_PATH)/oled_art.c $(USER_PATH)/oled_art.h
+$(USER_PATH)/oled_art.c: $(wildcard $(USER_PATH)/art/*.pbm $(USER_PATH)/art/*/*.pbm) $(JARI27_TOOLS)/sprite_pack.py
+	python3 $(JARI27_TOOLS)/sprite_pack.py
+	touch $@ $(USER_PATH)/oled_art.h
+$(USER_PATH)/oled_art.h: $(USER_PATH)/oled_art.c
+endif
+
+# font with only the characters the screens write, see tools/font_subset.py. made from the render functions of the
+# userspace and this keymap, the other keymaps it reads are picked up when they are built
+OLED_FONT_SUBSET ?= yes
+ifeq ($(strip $(OLED_ENABLE) $(OLED_FONT_SUBSET)), yes yes)
+    OPT_DEFS += -DOLED_FONT_SUBSET
+    FONT_SUBSET_SOURCES := $(filter-out $(USER_PATH)/glcdfont_subset.c,$(wildcard $(USER_PATH)/*.c)) \
+        $(wildcard $(USER_PATH)/config.h $(KEYMAP_PATH)/keymap.c $(KEYMAP_PATH)/config.h)
+generated-files: $(USER_PATH)/glcdfont_subset.c $(USER_PATH)/glcdfont_subset.h
+$(USER_PATH)/glcdfont_subset.c: $(FONT_SUBSET_SOURCES) $(JARI27_TOOLS)/font_subset.py
+	python3 $(JARI27_TOOLS)/font_subset.py
+	touch $@ $(USER_PATH)/glcdfont_subset.h
+$(USER_PATH)/glcdfont_subset.h: $(USER_PATH)/glcdfont_subset.c
+endif
+
+# screen, led and split work that waits while typing, see scheduler.h
+SCHEDULER_ENABLE ?= yes
+ifeq ($(strip $(SCHEDULER_ENABLE)), yes)
+    SRC += scheduler.c
+    OPT_DEFS += -DSCHEDULER_ENABLE
+    DEFERRED_EXEC_ENABLE = yes
+endif
+
+# indicator leds, drawn by the effects in rgb_matrix_user.inc
+ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
+    SRC += led_masks.c
+    RGB_MATRIX_CUSTOM_USER = yes
+endif
+
+# keystroke latency histograms, printed over the console with CS_LTCY
+LATENCY_STATS_ENABLE ?= yes
+ifeq ($(strip $(LATENCY_STATS_ENABLE)), yes)
+    SRC += latency_stats.c
+    OPT_DEFS += -DLATENCY_STATS_ENABLE
+endif
+
+# combo hits, near misses and timeouts, printed over the console with CS_CMBS
+COMBO_STATS_ENABLE ?= yes
+ifeq ($(strip $(COMBO_STATS_ENABLE)), yes)
+    SRC += combo_stats.c
+    OPT_DEFS += -DCOMBO_STATS_ENABLE
+endif
+
+# where the main loop spends its time, on the master oled and printed over the console with CS_PROF
+PROFILER_ENABLE ?= yes
+ifeq ($(strip $(PROFILER_ENABLE)), yes)
+    SRC += profiler.c
+    OPT_DEFS += -DPROFILER_ENABLE
+endif
+
+# macros recorded from what the host is sent and played back in as few reports as possible, CS_MREC and CS_MPLY
+MACRO_RECORDER_ENABLE ?= yes
+ifeq ($(strip $(MACRO_RECORDER_ENABLE)), yes)
+    SRC += macro_recorder.c
+    OPT_DEFS += -DMACRO_RECORDER_ENABLE
+endif
+
+# binary event trace, drained over the console while idle and decoded with tools/trace_decode.py
+# 0 = compiled out, 1 = state changes, 2 = key events, 3 = key events and queued reports
+TRACE_LEVEL ?= 2
+ifneq ($(strip $(TRACE_LEVEL)), 0)
+    SRC += trace_log.c
+    OPT_DEFS += -DTRACE_LOG_LEVEL=$(TRACE_LEVEL)
+endif
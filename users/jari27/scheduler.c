@@ -0,0 +1,43 @@
+#include "scheduler.h"
+
+typedef struct {
+    uint32_t period_ms; // 0 when no deferred executor was left, the job then always runs
+    bool     due;
+} scheduler_job_t;
+
+static scheduler_job_t jobs[SCHEDULER_JOB_COUNT] = {
+    [SCHEDULER_OLED] = {.period_ms = SCHEDULER_OLED_MS},
+    [SCHEDULER_RGB]  = {.period_ms = SCHEDULER_RGB_MS},
+    [SCHEDULER_SYNC] = {.period_ms = SCHEDULER_SYNC_MS},
+};
+
+static uint32_t scheduler_release(uint32_t trigger_time, void *cb_arg) {
+    scheduler_job_t *job = cb_arg;
+    job->due             = true;
+    return job->period_ms;
+}
+
+void scheduler_init(void) {
+    for (uint8_t i = 0; i < SCHEDULER_JOB_COUNT; i++) {
+        jobs[i].due = true;
+        if (defer_exec(jobs[i].period_ms, scheduler_release, &jobs[i]) == INVALID_DEFERRED_TOKEN) {
+            jobs[i].period_ms = 0;
+        }
+    }
+}
+
+bool scheduler_typing(void) {
+    return last_input_activity_elapsed() < SCHEDULER_TYPING_MS;
+}
+
+bool scheduler_due(uint8_t job) {
+    scheduler_job_t *entry = &jobs[job];
+    if (!scheduler_typing() || !entry->period_ms) {
+        return true;
+    }
+    if (!entry->due) {
+        return false;
+    }
+    entry->due = false;
+    return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// screen, led and split work that can wait while typing. within SCHEDULER_TYPING_MS of a key going down or up a job
+// only runs when QMK's deferred executor released it, every period below, and the oled draws a few widgets at a time.
+// at rest every job runs as often as QMK calls it, which catches up on whatever waited
+enum scheduler_job {
+    SCHEDULER_OLED = 0, // drawing the screens
+    SCHEDULER_RGB,      // a frame of the custom effects, a change of the indicators is drawn right away
+    SCHEDULER_SYNC,     // wpm and typing stats for the slave, layers and the os are sent right away
+    SCHEDULER_JOB_COUNT,
+};
+
+#ifndef SCHEDULER_TYPING_MS
+#    define SCHEDULER_TYPING_MS 300
+#endif
+#ifndef SCHEDULER_OLED_MS
+#    define SCHEDULER_OLED_MS 200 // instead of OLED_UPDATE_INTERVAL
+#endif
+#ifndef SCHEDULER_OLED_WIDGETS
+#    define SCHEDULER_OLED_WIDGETS 2 // master widgets drawn per update while typing
+#endif
+#ifndef SCHEDULER_RGB_MS
+#    define SCHEDULER_RGB_MS 128 // instead of RGB_MATRIX_LED_FLUSH_LIMIT
+#endif
+#ifndef SCHEDULER_SYNC_MS
+#    define SCHEDULER_SYNC_MS 250 // instead of every housekeeping pass
+#endif
+
+#ifdef SCHEDULER_ENABLE
+// starts the deferred executors, from keyboard_post_init_user
+void scheduler_init(void);
+
+// a key went down or up within SCHEDULER_TYPING_MS, on either half with SPLIT_ACTIVITY_ENABLE
+bool scheduler_typing(void);
+
+// whether the job may run now, which uses up its release while typing
+bool scheduler_due(uint8_t job);
+#else
+#    define scheduler_init()
+#    define scheduler_typing() false
+#    define scheduler_due(job) true
+#endif
@@ -0,0 +1,74 @@
+#include <string.h>
+
+#include "split_sync.h"
+#include "os_profile.h"
+#include "scheduler.h"
+#include "transactions.h"
+
+#ifndef SPLIT_SYNC_KEEPALIVE_MS
+#    define SPLIT_SYNC_KEEPALIVE_MS 1000 // for a slave that was reset and missed the last change
+#endif
+
+_Static_assert(sizeof(split_state_t) <= RPC_M2S_BUFFER_SIZE, "split_state_t does not fit an rpc");
+
+split_state_t split_state;
+
+static uint32_t sent_at; // or tried, when send_failed
+static bool     send_failed;
+
+static void split_sync_receive(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    const split_state_t *received = in_data;
+    if (in_buflen != sizeof(split_state_t) || received->version != SPLIT_SYNC_VERSION) {
+        return;
+    }
+    // written directly, like upstream's layer sync does, so the slave does not run the master's layer hooks
+    layer_state         = received->layer_state;
+    default_layer_state = received->default_layer_state;
+    if (received->wpm != split_state.wpm) {
+        set_current_wpm(received->wpm);
+    }
+    if (received->os != split_state.os) {
+        os_profile_select(received->os);
+    }
+    typing_stats_summary = received->typing;
+    typing_stats_shown   = received->typing_shown;
+    split_state = *received;
+}
+
+void split_sync_init(void) {
+    transaction_register_rpc(USER_SPLIT_SYNC, split_sync_receive);
+}
+
+void split_sync_task(void) {
+    if (!is_keyboard_master()) {
+        return;
+    }
+    // a slave that did not answer gets SCHEDULER_SYNC_MS before the next try, instead of a transaction every scan
+    if (send_failed && timer_elapsed32(sent_at) < SCHEDULER_SYNC_MS) {
+        return;
+    }
+    split_state_t state = {
+        .version             = SPLIT_SYNC_VERSION,
+        .layer_state         = layer_state,
+        .default_layer_state = default_layer_state,
+        .wpm                 = get_current_wpm(),
+        .os                  = selected_os,
+        .typing_shown        = typing_stats_shown,
+        .typing              = typing_stats_summary,
+    };
+    // the wpm and the typing stats change with every few keys, while typing they only go out every SCHEDULER_SYNC_MS
+    // or along with a change the slave has to show right away
+    split_state_t urgent = state;
+    urgent.wpm           = split_state.wpm;
+    urgent.typing        = split_state.typing;
+    if (!memcmp(&urgent, &split_state, sizeof(state)) && timer_elapsed32(sent_at) < SPLIT_SYNC_KEEPALIVE_MS &&
+        (!memcmp(&state, &split_state, sizeof(state)) || !scheduler_due(SCHEDULER_SYNC))) {
+        return;
+    }
+    // on failure split_state stays as it was, so the next try sends the same changes
+    send_failed = !transaction_rpc_send(USER_SPLIT_SYNC, sizeof(state), &state);
+    if (!send_failed) {
+        split_state = state;
+    }
+    sent_at = timer_read32();
+}
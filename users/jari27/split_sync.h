@@ -0,0 +1,30 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+#include "typing_stats.h"
+
+// bump when split_state_t changes, a half with other firmware then ignores the packets instead of misreading them
+#define SPLIT_SYNC_VERSION 4
+
+// everything the slave shows that only the master knows, in a single rpc that is only sent when something in it
+// changed. replaces SPLIT_LAYER_STATE_ENABLE, SPLIT_WPM_ENABLE and SPLIT_DETECTED_OS_ENABLE, which each run their
+// own transaction and resend it every 100ms whether it changed or not. the typing stats summary changes once a
+// second at most
+typedef struct __attribute__((packed)) {
+    uint8_t                version;
+    layer_state_t          layer_state;
+    layer_state_t          default_layer_state;
+    uint8_t                wpm;
+    uint8_t                os;           // selected_os
+    bool                   typing_shown; // typing_stats_shown
+    typing_stats_summary_t typing;
+} split_state_t;
+
+// on the master what was sent last, on the slave what was received last
+extern split_state_t split_state;
+
+// registers the rpc, from keyboard_post_init_user on both halves
+void split_sync_init(void);
+
+// master only: sends the state when it changed, and now and then as a keepalive. from housekeeping_task_user
+void split_sync_task(void);
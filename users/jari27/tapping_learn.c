@@ -0,0 +1,191 @@
+#include "tapping_learn.h"
+#include "user_settings.h"
+
+#define TAPPING_LEARN_BUCKET_MS 16
+#define TAPPING_LEARN_BUCKETS 32     // up to ~0.5s, anything longer goes in the last bucket
+#define TAPPING_LEARN_STEP_MS 4      // unit of user_settings.tapping_term_offset
+#define TAPPING_LEARN_MIN_TAPS 32    // samples before the term starts to move
+#define TAPPING_LEARN_MIN_HOLDS 8    // below this the term only follows the taps
+#define TAPPING_LEARN_EVERY 8        // samples per step
+#define TAPPING_LEARN_MARGIN_MS 32   // above the slow taps when there is nothing to go on for holds
+#define TAPPING_LEARN_MISFIRE_MS 64  // a lone hold this close to the term was meant as a tap
+
+typedef struct {
+    uint8_t  taps[TAPPING_LEARN_BUCKETS];
+    uint8_t  holds[TAPPING_LEARN_BUCKETS];
+    uint16_t pressed_at;
+    uint16_t base; // the configured term, from the last tapping_learn_term
+    bool     down;
+    bool     interrupted; // another key went down while this one was held
+    uint8_t  samples;     // since the last step
+} tapping_learn_key_t;
+
+static tapping_learn_key_t learn[USER_SETTINGS_TAPPING_KEYS];
+
+static int8_t tapping_learn_slot(uint16_t keycode) {
+    for (uint8_t slot = 0; slot < tapping_learn_key_count; slot++) {
+        if (tapping_learn_keys[slot] == keycode) {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+static void histogram_add(uint8_t *histogram, uint16_t ms) {
+    uint8_t bucket = ms / TAPPING_LEARN_BUCKET_MS;
+    if (bucket >= TAPPING_LEARN_BUCKETS) {
+        bucket = TAPPING_LEARN_BUCKETS - 1;
+    }
+    if (histogram[bucket] == UINT8_MAX) {
+        // halving everything keeps the counts in a byte and lets old samples fade out
+        for (uint8_t i = 0; i < TAPPING_LEARN_BUCKETS; i++) {
+            histogram[i] >>= 1;
+        }
+    }
+    histogram[bucket]++;
+}
+
+static uint16_t histogram_count(const uint8_t *histogram) {
+    uint16_t count = 0;
+    for (uint8_t i = 0; i < TAPPING_LEARN_BUCKETS; i++) {
+        count += histogram[i];
+    }
+    return count;
+}
+
+// middle of the bucket the percentile falls in
+static uint16_t histogram_percentile(const uint8_t *histogram, uint16_t count, uint8_t percent) {
+    uint16_t goal  = ((uint32_t)count * percent + 99) / 100;
+    uint16_t total = 0;
+    for (uint8_t i = 0; i < TAPPING_LEARN_BUCKETS; i++) {
+        total += histogram[i];
+        if (total >= goal) {
+            return i * TAPPING_LEARN_BUCKET_MS + TAPPING_LEARN_BUCKET_MS / 2;
+        }
+    }
+    return TAPPING_LEARN_BUCKETS * TAPPING_LEARN_BUCKET_MS;
+}
+
+static uint16_t tapping_learn_target(const tapping_learn_key_t *key, uint16_t tap_count) {
+    uint16_t slow_tap   = histogram_percentile(key->taps, tap_count, 95);
+    uint16_t hold_count = histogram_count(key->holds);
+    if (hold_count >= TAPPING_LEARN_MIN_HOLDS) {
+        uint16_t fast_hold = histogram_percentile(key->holds, hold_count, 5);
+        if (fast_hold > slow_tap) {
+            return (slow_tap + fast_hold) / 2;
+        }
+    }
+    // no holds yet, or they overlap the taps: misfiring as a mod is worse than having to hold a little longer
+    return slow_tap + TAPPING_LEARN_MARGIN_MS;
+}
+
+// the offsets that keep the term within half and twice base, so the clamp in tapping_learn_term never hides a step
+static int8_t tapping_learn_offset_min(uint16_t base) {
+    int16_t min = -(int16_t)((base - base / 2) / TAPPING_LEARN_STEP_MS);
+    return min < INT8_MIN ? INT8_MIN : min;
+}
+
+static int8_t tapping_learn_offset_max(uint16_t base) {
+    uint16_t max = base / TAPPING_LEARN_STEP_MS;
+    return max > INT8_MAX ? INT8_MAX : max;
+}
+
+static void tapping_learn_step(uint8_t slot, uint16_t term) {
+    tapping_learn_key_t *key       = &learn[slot];
+    uint16_t             tap_count = histogram_count(key->taps);
+    if (++key->samples < TAPPING_LEARN_EVERY || tap_count < TAPPING_LEARN_MIN_TAPS) {
+        return;
+    }
+    key->samples = 0;
+
+    uint16_t target   = tapping_learn_target(key, tap_count);
+    int8_t  *offset   = &user_settings.tapping_term_offset[slot];
+    int8_t   previous = *offset;
+    if (target > term + TAPPING_LEARN_STEP_MS && *offset < tapping_learn_offset_max(key->base)) {
+        (*offset)++;
+    } else if (target + TAPPING_LEARN_STEP_MS < term && *offset > tapping_learn_offset_min(key->base)) {
+        (*offset)--;
+    }
+    if (*offset != previous) {
+        user_settings_changed();
+    }
+}
+
+void tapping_learn_record(uint16_t keycode, keyrecord_t *record) {
+    int8_t slot = tapping_learn_slot(keycode);
+    if (record->event.pressed) {
+        for (uint8_t i = 0; i < tapping_learn_key_count; i++) {
+            learn[i].interrupted = true;
+        }
+        if (slot >= 0) {
+            learn[slot].down        = true;
+            learn[slot].interrupted = false;
+            learn[slot].pressed_at  = record->event.time;
+        }
+        return;
+    }
+    if (slot < 0 || !learn[slot].down) {
+        return;
+    }
+    tapping_learn_key_t *key  = &learn[slot];
+    uint16_t             held = TIMER_DIFF_16(record->event.time, key->pressed_at);
+    uint16_t             term = get_tapping_term(keycode, record);
+    key->down                 = false;
+    if (record->tap.count) {
+        histogram_add(key->taps, held);
+    } else if (key->interrupted) {
+        histogram_add(key->holds, held);
+    } else if (held < term + TAPPING_LEARN_MISFIRE_MS) {
+        // held just past the term with nothing else pressed, so it did nothing: a slow tap
+        histogram_add(key->taps, held);
+    } else {
+        // a long hold on its own, e.g. shift for a mouse click, says nothing about taps
+        return;
+    }
+    tapping_learn_step(slot, term);
+}
+
+void tapping_learn_init(void) {
+    for (uint8_t slot = 0; slot < tapping_learn_key_count; slot++) {
+        // the keymap's get_tapping_term hands tapping_learn_term the base of the key
+        get_tapping_term(tapping_learn_keys[slot], NULL);
+        int8_t *offset = &user_settings.tapping_term_offset[slot];
+        int8_t  min    = tapping_learn_offset_min(learn[slot].base);
+        int8_t  max    = tapping_learn_offset_max(learn[slot].base);
+        if (*offset < min || *offset > max) {
+            // stored before the steps were bounded, or the configured term changed since
+            *offset = *offset < min ? min : max;
+            user_settings_changed();
+        }
+    }
+}
+
+uint16_t tapping_learn_term(uint16_t keycode, uint16_t base) {
+    int8_t slot = tapping_learn_slot(keycode);
+    if (slot < 0) {
+        return base;
+    }
+    learn[slot].base = base;
+    // a bad run of samples can not take a key further than half or twice its configured term
+    int16_t term = base + user_settings.tapping_term_offset[slot] * TAPPING_LEARN_STEP_MS;
+    if (term < base / 2) {
+        return base / 2;
+    }
+    if (term > base * 2) {
+        return base * 2;
+    }
+    return term;
+}
+
+void tapping_learn_print(void) {
+    uprintf("key   term   taps  p95  holds   p5\n");
+    for (uint8_t slot = 0; slot < tapping_learn_key_count; slot++) {
+        const tapping_learn_key_t *key     = &learn[slot];
+        uint16_t                   keycode = tapping_learn_keys[slot];
+        uint16_t                   taps    = histogram_count(key->taps);
+        uint16_t                   holds   = histogram_count(key->holds);
+        uprintf("%04X %5u %6u %4u %6u %4u\n", keycode, get_tapping_term(keycode, NULL), taps,
+                taps ? histogram_percentile(key->taps, taps, 95) : 0, holds,
+                holds ? histogram_percentile(key->holds, holds, 5) : 0);
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// per-key tapping terms that follow how long each tap-hold key is really held. taps and holds go into decaying
+// histograms, and the term moves a step at a time towards the middle of the gap between the two. the steps are kept
+// in user_settings.tapping_term_offset, so what was learned survives a reboot
+
+// tap-hold keys that learn, defined in keymap.c. the index is the user settings slot, so only append
+extern const uint16_t tapping_learn_keys[];
+extern const uint8_t  tapping_learn_key_count;
+
+// brings stored offsets back within range of the configured terms, after user_settings_init
+void tapping_learn_init(void);
+
+// from process_record_user, with the keycode from the keymap
+void tapping_learn_record(uint16_t keycode, keyrecord_t *record);
+
+// the learned term for keycode, or base for keys that do not learn. from get_tapping_term
+uint16_t tapping_learn_term(uint16_t keycode, uint16_t base);
+
+void tapping_learn_print(void);
@@ -0,0 +1,17 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+#ifdef PROTOCOL_CHIBIOS
+#    include <ch.h>
+#endif
+
+// a microsecond clock for the latency stats and the profiler, it wraps after ~71 minutes. without chibios it only
+// counts whole milliseconds
+static inline uint32_t timer_us_now(void) {
+#ifdef PROTOCOL_CHIBIOS
+    return TIME_I2US(chVTGetSystemTimeX()); // rp2040 runs the system timer at 1MHz
+#else
+    return timer_read32() * 1000;
+#endif
+}
@@ -0,0 +1,78 @@
+#include "trace_log.h"
+
+// records are kept in RAM and only written to the console once the keyboard has been idle for a while,
+// so typing never waits on the console endpoint. tools/trace_decode.py turns the output back into text.
+
+#ifndef TRACE_LOG_SIZE
+#    define TRACE_LOG_SIZE 64 // records, must be a power of two
+#endif
+#ifndef TRACE_LOG_IDLE_MS
+#    define TRACE_LOG_IDLE_MS 250
+#endif
+#ifndef TRACE_LOG_DRAIN_PER_TASK
+#    define TRACE_LOG_DRAIN_PER_TASK 2
+#endif
+
+_Static_assert(TRACE_LOG_SIZE <= 128 && (TRACE_LOG_SIZE & (TRACE_LOG_SIZE - 1)) == 0,
+               "TRACE_LOG_SIZE must be a power of two up to 128");
+
+typedef struct __attribute__((packed)) {
+    uint8_t  type;
+    uint8_t  layer;
+    uint8_t  mods;
+    uint8_t  key;
+    uint16_t keycode;
+    uint32_t time;
+} trace_record_t;
+
+static trace_record_t records[TRACE_LOG_SIZE];
+static uint8_t        head;
+static uint8_t        tail;
+static uint16_t       dropped;
+
+static void trace_log_push(uint8_t type, uint16_t keycode, uint8_t key) {
+    if ((uint8_t)(head - tail) == TRACE_LOG_SIZE) {
+        dropped++;
+        return;
+    }
+    trace_record_t *record = &records[head % TRACE_LOG_SIZE];
+    record->type           = type;
+    record->layer          = get_highest_layer(layer_state | default_layer_state);
+    record->mods           = get_mods() | get_oneshot_mods();
+    record->key            = key;
+    record->keycode        = keycode;
+    record->time           = timer_read32();
+    head++;
+}
+
+void trace_log(uint8_t type, uint16_t keycode, uint8_t key) {
+    if (dropped && (uint8_t)(head - tail) < TRACE_LOG_SIZE - 1) {
+        trace_log_push(TRACE_DROPPED, dropped, 0);
+        dropped = 0;
+    }
+    trace_log_push(type, keycode, key);
+}
+
+static void trace_log_write(const trace_record_t *record) {
+    static const char hex[] = "0123456789ABCDEF";
+    const uint8_t    *bytes = (const uint8_t *)record;
+
+    // the console pads its packets with zeroes, so the raw bytes go out as hex
+    sendchar('#');
+    sendchar('T');
+    for (uint8_t i = 0; i < sizeof(*record); i++) {
+        sendchar(hex[bytes[i] >> 4]);
+        sendchar(hex[bytes[i] & 0x0F]);
+    }
+    sendchar('\n');
+}
+
+void trace_log_task(void) {
+    if (head == tail || last_input_activity_elapsed() < TRACE_LOG_IDLE_MS) {
+        return;
+    }
+    for (uint8_t i = 0; i < TRACE_LOG_DRAIN_PER_TASK && head != tail; i++) {
+        trace_log_write(&records[tail % TRACE_LOG_SIZE]);
+        tail++;
+    }
+}
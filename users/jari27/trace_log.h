@@ -0,0 +1,46 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// TRACE_LOG_LEVEL comes from TRACE_LEVEL in rules.mk:
+// 0 - compiled out
+// 1 - state changes: layers, default layer, os and dropped records
+// 2 - key events as they reach process_record_user
+// 3 - also the moment the resulting report is queued
+#ifndef TRACE_LOG_LEVEL
+#    define TRACE_LOG_LEVEL 0
+#endif
+
+enum trace_event {
+    TRACE_KEY = 1,
+    TRACE_REPORT,
+    TRACE_LAYER,
+    TRACE_DEFAULT_LAYER,
+    TRACE_OS,
+    TRACE_DROPPED,
+};
+
+#if TRACE_LOG_LEVEL >= 1
+void trace_log(uint8_t type, uint16_t keycode, uint8_t key);
+void trace_log_task(void);
+#    define trace_state(type, value) trace_log(type, value, 0)
+#else
+#    define trace_log_task()
+#    define trace_state(type, value)
+#endif
+
+#if TRACE_LOG_LEVEL >= 2
+#    define trace_key(keycode, record) trace_log(TRACE_KEY, keycode, trace_log_key(record))
+#else
+#    define trace_key(keycode, record)
+#endif
+
+#if TRACE_LOG_LEVEL >= 3
+#    define trace_report(keycode, record) trace_log(TRACE_REPORT, keycode, trace_log_key(record))
+#else
+#    define trace_report(keycode, record)
+#endif
+
+// row in the low nibble, column in bits 4-6 and pressed in bit 7
+#define trace_log_key(record) \
+    (((record)->event.key.row & 0x0F) | (((record)->event.key.col & 0x07) << 4) | ((record)->event.pressed << 7))
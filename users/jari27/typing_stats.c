@@ -0,0 +1,201 @@
+#include "typing_stats.h"
+#ifdef OLED_ENABLE
+#    include "oled_widgets.h"
+#endif
+
+#define INTERVALS 32 // power of two, the ring index wraps with a mask
+#define BURST 8
+#define NO_LAYER 0xFF
+
+#ifndef TYPING_STATS_PAUSE_MS
+#    define TYPING_STATS_PAUSE_MS 1000 // a longer gap between key presses is a pause, not typing
+#endif
+#ifndef TYPING_STATS_SUMMARY_MS
+#    define TYPING_STATS_SUMMARY_MS 1000
+#endif
+// the backspace ratio is an exponential average in 0.16 fixed point, each key press moves it 1/64 of the way
+#define BSPC_ONE ((int32_t)1 << 16)
+#define BSPC_SHIFT 6
+
+_Static_assert((INTERVALS & (INTERVALS - 1)) == 0 && BURST < INTERVALS, "bad interval ring size");
+
+typing_stats_summary_t typing_stats_summary = {.top_layer = {NO_LAYER, NO_LAYER, NO_LAYER}};
+bool                   typing_stats_shown;
+
+// milliseconds between key presses, the sums always match what is in the ring so nothing is summed on a key press
+static uint16_t intervals[INTERVALS];
+static uint8_t  head;
+static uint8_t  filled;         // valid entries in the ring, pauses do not clear it
+static uint8_t  streak;         // intervals since the last pause, up to BURST
+static uint32_t interval_sum;   // of the last filled intervals
+static uint32_t burst_sum;      // of the last streak intervals, at most BURST
+static uint32_t best_burst_sum; // shortest burst_sum over BURST intervals, 0 until there is one
+static uint32_t last_press;
+static bool     pressed_any;
+static int32_t  bspc_ratio;
+
+static uint32_t layer_keys[TYPING_STATS_LAYERS];
+static uint32_t layer_ms[TYPING_STATS_LAYERS];
+static uint32_t total_keys;
+static uint32_t last_task;
+static uint32_t last_summary;
+
+static uint8_t current_layer(void) {
+    uint8_t layer = get_highest_layer(layer_state | default_layer_state);
+    return layer < TYPING_STATS_LAYERS ? layer : TYPING_STATS_LAYERS - 1;
+}
+
+static void push_interval(uint16_t interval) {
+    if (streak >= BURST) {
+        burst_sum -= intervals[(head - BURST) & (INTERVALS - 1)];
+    } else {
+        streak++;
+    }
+    burst_sum += interval;
+    if (filled == INTERVALS) {
+        interval_sum -= intervals[head];
+    } else {
+        filled++;
+    }
+    interval_sum += interval;
+    intervals[head] = interval;
+    head            = (head + 1) & (INTERVALS - 1);
+    if (streak == BURST && (!best_burst_sum || burst_sum < best_burst_sum)) {
+        best_burst_sum = burst_sum;
+    }
+}
+
+void typing_stats_record(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        return;
+    }
+    // a tap-hold key counts when it is tapped, held it is a modifier or a layer and not typing
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        if (!record->tap.count) {
+            return;
+        }
+        keycode = IS_QK_MOD_TAP(keycode) ? QK_MOD_TAP_GET_TAP_KEYCODE(keycode) : QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    }
+    uint32_t now      = timer_read32();
+    uint32_t interval = now - last_press;
+    if (!pressed_any || interval > TYPING_STATS_PAUSE_MS) {
+        streak    = 0;
+        burst_sum = 0;
+    } else {
+        push_interval(interval);
+    }
+    last_press  = now;
+    pressed_any = true;
+
+    bspc_ratio += ((keycode == KC_BSPC ? BSPC_ONE : 0) - bspc_ratio) >> BSPC_SHIFT;
+    layer_keys[current_layer()]++;
+    total_keys++;
+}
+
+static uint8_t wpm_of(uint32_t presses, uint32_t ms) {
+    // a word is 5 key presses, so presses per ms times 60000 / 5
+    uint32_t wpm = ms ? presses * 12000 / ms : 0;
+    return wpm < UINT8_MAX ? wpm : UINT8_MAX;
+}
+
+static void typing_stats_summarize(void) {
+    typing_stats_summary_t summary = {
+        .wpm       = wpm_of(filled, interval_sum),
+        .burst_wpm = wpm_of(BURST, best_burst_sum),
+        .bspc_pct  = (bspc_ratio * 100 + BSPC_ONE / 2) >> 16,
+    };
+    uint32_t taken = 0; // layers already picked, as a mask
+    for (uint8_t rank = 0; rank < TYPING_STATS_TOP_LAYERS; rank++) {
+        uint8_t best = NO_LAYER;
+        for (uint8_t layer = 0; layer < TYPING_STATS_LAYERS; layer++) {
+            if (!layer_keys[layer] || taken & (1ul << layer)) {
+                continue;
+            }
+            if (best == NO_LAYER || layer_keys[layer] > layer_keys[best]) {
+                best = layer;
+            }
+        }
+        summary.top_layer[rank] = best;
+        if (best != NO_LAYER) {
+            taken |= 1ul << best;
+            summary.top_pct[rank] = layer_keys[best] * 100 / total_keys;
+        }
+    }
+    typing_stats_summary = summary;
+}
+
+void typing_stats_task(void) {
+    // the slave gets the summary from the master, see split_sync.c
+    if (!is_keyboard_master()) {
+        return;
+    }
+    uint32_t now = timer_read32();
+    // only time spent typing counts towards a layer, otherwise an idle keyboard is all base layer
+    if (pressed_any && now - last_press <= TYPING_STATS_PAUSE_MS) {
+        layer_ms[current_layer()] += now - last_task;
+    }
+    last_task = now;
+    if (now - last_summary >= TYPING_STATS_SUMMARY_MS) {
+        typing_stats_summarize();
+        last_summary = now;
+    }
+}
+
+#ifdef OLED_ENABLE
+static void render_number(uint8_t value, char suffix) {
+    char str[] = {suffix, 0};
+    oled_write_text_P(PSTR(" "));
+    oled_render_number(value);
+    oled_write_text(str);
+}
+
+void typing_stats_render(const typing_stats_summary_t *summary) {
+    // every line is exactly 5 characters, so nothing wraps
+    oled_write_text_P(PSTR("wpm  "));
+    render_number(summary->wpm, ' ');
+    oled_write_text_P(PSTR("     "));
+    oled_write_text_P(PSTR("burst"));
+    render_number(summary->burst_wpm, ' ');
+    oled_write_text_P(PSTR("     "));
+    oled_write_text_P(PSTR("bspc "));
+    render_number(summary->bspc_pct, '%');
+    oled_write_text_P(PSTR("     "));
+    oled_write_text_P(PSTR("layer"));
+    for (uint8_t rank = 0; rank < TYPING_STATS_TOP_LAYERS; rank++) {
+        uint8_t layer = summary->top_layer[rank];
+        uint8_t pct   = summary->top_pct[rank] < 99 ? summary->top_pct[rank] : 99;
+        // layer as a hex digit and two digits of percentage: "4:62%"
+        char str[] = {"0123456789ABCDEF"[layer & 0x0F], ':', '0' + pct / 10, '0' + pct % 10, '%', 0};
+        oled_write_text(layer == NO_LAYER ? "     " : str);
+    }
+}
+#endif
+
+void typing_stats_print(void) {
+    typing_stats_summarize();
+    uprintf("typing: wpm %u, burst %u, backspace %u%%, %lu keys\n", typing_stats_summary.wpm,
+            typing_stats_summary.burst_wpm, typing_stats_summary.bspc_pct, (unsigned long)total_keys);
+    uprintf("layer    keys   %%   seconds\n");
+    for (uint8_t layer = 0; layer < TYPING_STATS_LAYERS; layer++) {
+        if (!layer_keys[layer] && !layer_ms[layer]) {
+            continue;
+        }
+        uprintf("%5u %7lu %3lu %9lu\n", layer, (unsigned long)layer_keys[layer],
+                (unsigned long)(total_keys ? layer_keys[layer] * 100 / total_keys : 0),
+                (unsigned long)(layer_ms[layer] / 1000));
+    }
+}
+
+void typing_stats_reset(void) {
+    filled         = 0;
+    streak         = 0;
+    interval_sum   = 0;
+    burst_sum      = 0;
+    best_burst_sum = 0;
+    pressed_any    = false;
+    bspc_ratio     = 0;
+    total_keys     = 0;
+    memset(layer_keys, 0, sizeof(layer_keys));
+    memset(layer_ms, 0, sizeof(layer_ms));
+    typing_stats_summarize();
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// typing speed, backspace ratio and layer usage, to compare layouts by what was typed instead of by feel.
+// every key press updates the counters in constant time without dividing, the numbers that need a division are
+// worked out once a second into typing_stats_summary_t, which the master also sends to the slave oled
+
+#ifndef TYPING_STATS_LAYERS
+#    define TYPING_STATS_LAYERS 16
+#endif
+#define TYPING_STATS_TOP_LAYERS 3
+
+typedef struct __attribute__((packed)) {
+    uint8_t wpm;       // over the last 32 key presses, pauses left out
+    uint8_t burst_wpm; // fastest 8 key presses in a row since the last reset
+    uint8_t bspc_pct;  // share of key presses that were backspace, decaying over roughly the last 64
+    uint8_t top_layer[TYPING_STATS_TOP_LAYERS]; // layers with the most key presses, 0xFF when unused
+    uint8_t top_pct[TYPING_STATS_TOP_LAYERS];   // their share of all key presses
+} typing_stats_summary_t;
+
+extern typing_stats_summary_t typing_stats_summary;
+
+// the summary instead of the art on the slave oled, toggled with CS_TYPS on the master and sent with the split sync
+extern bool typing_stats_shown;
+
+// from process_record_user, with the keycode from the keymap
+void typing_stats_record(uint16_t keycode, keyrecord_t *record);
+
+// layer time and the summary, from housekeeping_task_user
+void typing_stats_task(void);
+
+// the summary on 13 lines of 5 characters from the cursor on, for the slave oled
+void typing_stats_render(const typing_stats_summary_t *summary);
+
+void typing_stats_print(void);
+void typing_stats_reset(void);
@@ -0,0 +1,59 @@
+#include <string.h>
+
+#include "user_settings.h"
+
+// eeprom on the rp2040 is emulated in flash, and a write can hold up the scan loop for a while. so nothing is written
+// from a key press: changes wait in ram until the keyboard has been idle and the settings have stopped changing, and
+// then go out in a single update that only touches the bytes that differ.
+
+#ifndef USER_SETTINGS_DEBOUNCE_MS
+#    define USER_SETTINGS_DEBOUNCE_MS 5000 // since the last change
+#endif
+#ifndef USER_SETTINGS_IDLE_MS
+#    define USER_SETTINGS_IDLE_MS 1000 // since the last key or encoder activity
+#endif
+
+_Static_assert(sizeof(user_settings_t) <= USER_SETTINGS_SIZE, "USER_SETTINGS_SIZE is too small");
+
+user_settings_t user_settings;
+
+static bool     dirty;
+static uint32_t changed_at;
+
+static void user_settings_defaults(void) {
+    memset(&user_settings, 0, sizeof(user_settings));
+    user_settings.version = USER_SETTINGS_VERSION;
+    user_settings.os      = OS_UNSURE;
+    user_settings.rgb_val = RGB_MATRIX_MAXIMUM_BRIGHTNESS / 2;
+}
+
+void user_settings_init(void) {
+    eeconfig_read_user_datablock(&user_settings, 0, sizeof(user_settings));
+    if (user_settings.version != USER_SETTINGS_VERSION) {
+        // first boot, a cleared eeprom or an older layout. the defaults are only written once something changes
+        user_settings_defaults();
+    }
+}
+
+void user_settings_changed(void) {
+    dirty      = true;
+    changed_at = timer_read32();
+}
+
+void user_settings_flush(void) {
+    if (!dirty) {
+        return;
+    }
+    dirty = false;
+    user_settings.writes++;
+    // only bytes that differ from what is stored end up in the wear levelling log
+    eeconfig_update_user_datablock(&user_settings, 0, sizeof(user_settings));
+    dprintf("settings: write %u\n", user_settings.writes);
+}
+
+void user_settings_task(void) {
+    if (dirty && timer_elapsed32(changed_at) >= USER_SETTINGS_DEBOUNCE_MS &&
+        last_input_activity_elapsed() >= USER_SETTINGS_IDLE_MS) {
+        user_settings_flush();
+    }
+}
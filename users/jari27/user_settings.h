@@ -0,0 +1,32 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// bump when the layout of user_settings_t changes, older records are replaced by the defaults
+#define USER_SETTINGS_VERSION 1
+#define USER_SETTINGS_TAPPING_KEYS 8
+
+// stored at the start of the eeconfig user datablock, USER_SETTINGS_SIZE in config.h has to fit it
+typedef struct __attribute__((packed)) {
+    uint8_t  version;
+    uint16_t writes;        // flash writes so far, to keep an eye on wear
+    uint8_t  os;            // CS_SWAP_OS override, OS_UNSURE follows detection
+    uint8_t  default_layer; // set with PDF()
+    uint8_t  rgb_val;       // brightness the os colour is shown with
+    int8_t   tapping_term_offset[USER_SETTINGS_TAPPING_KEYS];
+} user_settings_t;
+
+// read freely, call user_settings_changed() after changing anything
+extern user_settings_t user_settings;
+
+// loads the record, or the defaults if there is none yet. from keyboard_post_init_user
+void user_settings_init(void);
+
+// changes are kept in ram and written once the keyboard has been idle for a while
+void user_settings_changed(void);
+
+// writes pending changes when idle, from housekeeping_task_user
+void user_settings_task(void);
+
+// writes pending changes right away, e.g. before jumping to the bootloader
+void user_settings_flush(void);